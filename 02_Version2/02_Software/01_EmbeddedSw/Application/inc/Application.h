@@ -24,6 +24,11 @@
 #include "DIALOG.h"
 #include "GUI.h"
 #include "portmacro.h"
+#include "LcdBacklight.h"
+#include "SolderingModel.h"
+#include "TempTrend.h"
+#include "Encoder.h"
+#include "Settings.h"
 /*Defines*/
 #define NumberOfADCSampleAvegrage (3u)
 /*Function declarations*/
@@ -35,10 +40,12 @@ void ftoa(float n, char *res, int afterpoint);
 void SendMeasurements(void);
 void MainTask(void);
 void MainInit(void);
-void StateMachine(void);
-extern void StateMachine(void);
+void ControlHandler(void);
 void PID_Discrete(void);
 void PID_Continous(void);
 void InterruptTaskHandler(uint16_t);
 void TimerCallback_1ms(void);
+void BacklightHandler(void);
+void ApplySettings(void);
+void SelectNextPreset(void);
 #endif /* APPLICATION_H_ */
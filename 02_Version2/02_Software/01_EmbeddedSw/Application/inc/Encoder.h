@@ -0,0 +1,99 @@
+/**
+ * @file Encoder.h
+ *
+ * Rotary encoder of the front panel (TIM2 in encoder mode, the button on EXTI).
+ * The detents are accelerated by the turning speed and go to one target at a time:
+ * to the setpoint (ControlHandler()) or to the GUI (the LVGL input device).
+ * The button edges are queued by the InterruptTask and read by the GUI task.
+ *
+ */
+
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef ENCODER_BUTTON_QUEUE_SIZE
+#define ENCODER_BUTTON_QUEUE_SIZE   8       /*power of 2*/
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    ENCODER_TARGET_SETPOINT,
+    ENCODER_TARGET_GUI,
+} Encoder_Target_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start counting from the current position of the counter. Targets the setpoint.
+ * @param cnt   the counter of the timer
+ * @param tick  [ms] current time
+ */
+void Encoder_Init(uint16_t cnt, uint32_t tick);
+
+/**
+ * Take the detents turned since the last call, accelerate them and add them to the target.
+ * Call it periodically from the GUI task.
+ * @param cnt   the counter of the timer
+ * @param tick  [ms] current time
+ */
+void Encoder_Update(uint16_t cnt, uint32_t tick);
+
+/**
+ * Select where the detents go. The detents not taken by the previous target are dropped.
+ * @param target the new target
+ */
+void Encoder_SetTarget(Encoder_Target_t target);
+
+/**
+ * Get the detents collected for a target and clear them
+ * @param target    the caller
+ * @return          accelerated detents, positive: clockwise; 0 if `target` is not the current target
+ */
+int32_t Encoder_TakeSteps(Encoder_Target_t target);
+
+/**
+ * Check if a target has detents to take
+ * @param target    the caller
+ * @return          true: Encoder_TakeSteps() would return non zero
+ */
+bool Encoder_HasSteps(Encoder_Target_t target);
+
+/**
+ * Queue an edge of the button. Called from the InterruptTask.
+ * @param pressed   true: pressed; false: released
+ */
+void Encoder_ButtonEvent(bool pressed);
+
+/**
+ * Get the oldest queued edge of the button
+ * @param pressed   store the state after the edge here
+ * @return          true: an edge was queued; false: the queue is empty
+ */
+bool Encoder_GetButtonEvent(bool * pressed);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* ENCODER_H */
@@ -0,0 +1,76 @@
+/**
+ * @file Perf.h
+ *
+ * Time stamps for measuring short code sections (draw times, GUI ticks).
+ * The cycle counter of the core (DWT->CYCCNT) on the target, CLOCK_MONOTONIC on the host.
+ * Differences of time stamps are valid up to 2^32 ticks (~23 s at 180 MHz).
+ *
+ */
+
+#ifndef PERF_H
+#define PERF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+#ifdef USE_HAL_DRIVER
+#include "main.h"
+#else
+#include <time.h>
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start the cycle counter. Can be called more times.
+ */
+static inline void Perf_Init(void)
+{
+#ifdef USE_HAL_DRIVER
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/**
+ * Get a time stamp
+ * @return the time in ticks of the counter
+ */
+static inline uint32_t Perf_Now(void)
+{
+#ifdef USE_HAL_DRIVER
+    return DWT->CYCCNT;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)ts.tv_sec * 1000000U + (uint32_t)(ts.tv_nsec / 1000);
+#endif
+}
+
+/**
+ * Convert a difference of time stamps to microseconds
+ * @param ticks `Perf_Now() - start`
+ * @return the time in us
+ */
+static inline uint32_t Perf_ToUs(uint32_t ticks)
+{
+#ifdef USE_HAL_DRIVER
+    return ticks / (SystemCoreClock / 1000000U);
+#else
+    return ticks;
+#endif
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* PERF_H */
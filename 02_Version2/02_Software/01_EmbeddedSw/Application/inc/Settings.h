@@ -0,0 +1,151 @@
+/**
+ * @file Settings.h
+ *
+ * Persistent user settings. Every setting has a virtual address of the EEPROM
+ * emulation, a range and a default. The values are read once by Settings_Init()
+ * and served from RAM afterwards. A change is written to the flash only when
+ * the setting hasn't been touched for SETTINGS_FLUSH_DELAY (write-behind), and
+ * only if it differs from the stored value: scrolling through the presets or
+ * turning the encoder back and forth costs at most one write per setting.
+ *
+ * Used from the GUI task only.
+ *
+ */
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef SETTINGS_FLUSH_DELAY
+#define SETTINGS_FLUSH_DELAY    3000    /*[ms] a change is stored after it has settled for this long*/
+#endif
+
+#define SETTINGS_PRESET_NUM         3
+#define SETTINGS_TIP_NUM            3
+#define SETTINGS_PID_PROFILE_NUM    3
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    SETTINGS_SETPOINT,                  /*[°C]*/
+    SETTINGS_KP,                        /*[1/100] gains of the tuned PID profile*/
+    SETTINGS_KI,
+    SETTINGS_KD,
+    SETTINGS_PRESET_1,                  /*[°C]*/
+    SETTINGS_PRESET_LAST = SETTINGS_PRESET_1 + SETTINGS_PRESET_NUM - 1,
+    SETTINGS_SLEEP_TEMPERATURE,         /*[°C] setpoint limit in the holder*/
+    SETTINGS_SLEEP_DELAY,               /*[s] in the holder before sleeping*/
+    SETTINGS_TIP_TYPE,                  /*0..SETTINGS_TIP_NUM-1*/
+    SETTINGS_PID_PROFILE,               /*0: the tuned gains, then the built-in profiles*/
+    SETTINGS_CAL_OFFSET_1,              /*[°C] calibration offset of the first tip type*/
+    SETTINGS_CAL_OFFSET_LAST = SETTINGS_CAL_OFFSET_1 + SETTINGS_TIP_NUM - 1,
+    _SETTINGS_NUM
+} Settings_Id_t;
+
+/*Access to the non-volatile memory (the EEPROM emulation on the target)*/
+typedef struct {
+    bool (*read)(uint16_t addr, uint16_t * value);     /*false: not stored yet*/
+    bool (*write)(uint16_t addr, uint16_t value);      /*false: error*/
+} Settings_Storage_t;
+
+typedef struct {
+    uint32_t writes;        /*values written to the storage*/
+    uint32_t skipped;       /*settled changes equal to the stored value*/
+    uint32_t errors;        /*failed writes*/
+} Settings_Stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Load every setting from the storage. Missing or out of range values are replaced
+ * by their default (and written only if they are changed).
+ * @param storage   access to the storage, has to remain valid
+ * @param tick      [ms] current time
+ */
+void Settings_Init(const Settings_Storage_t * storage, uint32_t tick);
+
+/**
+ * Get the value of a setting from the RAM cache
+ * @param id    the setting
+ * @return      its value
+ */
+int32_t Settings_Get(Settings_Id_t id);
+
+/**
+ * Change a setting in the RAM cache. The value is clamped to the range of the setting
+ * and rounded to its resolution. It is stored by Settings_Handler() when settled.
+ * @param id    the setting
+ * @param value the new value
+ * @return      true: the value has changed
+ */
+bool Settings_Set(Settings_Id_t id, int32_t value);
+
+/**
+ * Get the range of a setting
+ * @param id    the setting
+ * @param min   store the smallest value here (can be NULL)
+ * @param max   store the largest value here (can be NULL)
+ */
+void Settings_GetRange(Settings_Id_t id, int32_t * min, int32_t * max);
+
+/**
+ * Get the virtual address of a setting in the storage
+ * @param id    the setting
+ * @return      the address
+ */
+uint16_t Settings_GetAddress(Settings_Id_t id);
+
+/**
+ * Write the settled changes to the storage. Call it periodically.
+ * @param tick  [ms] current time
+ * @return      false: a write has failed, it is retried SETTINGS_FLUSH_DELAY later
+ */
+bool Settings_Handler(uint32_t tick);
+
+/**
+ * Write every pending change now, settled or not
+ * @return      false: a write has failed
+ */
+bool Settings_Flush(void);
+
+/**
+ * Check if there are changes not stored yet
+ * @return      true: Settings_Handler() or Settings_Flush() has something to write
+ */
+bool Settings_IsDirty(void);
+
+/**
+ * Get the statistics collected since the last Settings_ClearStats()
+ * @return pointer to the statistics
+ */
+const Settings_Stats_t * Settings_GetStats(void);
+
+/**
+ * Zero the statistics
+ */
+void Settings_ClearStats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SETTINGS_H */
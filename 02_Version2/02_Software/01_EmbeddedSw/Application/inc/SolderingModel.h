@@ -0,0 +1,114 @@
+/**
+ * @file SolderingModel.h
+ *
+ * State of the soldering station as the user interface shows it.
+ * The control layer (ControlHandler() in Application.c) publishes it with
+ * SolderingModel_Update(), the views register an observer and get a mask of
+ * the fields which have changed, so they redraw only those.
+ *
+ * Not thread safe: update and observe it from the GUI task.
+ *
+ */
+
+#ifndef SOLDERINGMODEL_H
+#define SOLDERINGMODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef SOLDERING_MODEL_OBSERVER_MAX
+#define SOLDERING_MODEL_OBSERVER_MAX    4
+#endif
+
+/*Bits of the change mask, one for every field of SolderingModel_t*/
+#define SOLDERING_MODEL_SETPOINT        (1U << 0)
+#define SOLDERING_MODEL_ACTIVE_SETPOINT (1U << 1)
+#define SOLDERING_MODEL_TIP_TEMPERATURE (1U << 2)
+#define SOLDERING_MODEL_HEATING_POWER   (1U << 3)
+#define SOLDERING_MODEL_STATE           (1U << 4)
+#define SOLDERING_MODEL_IN_HOLDER       (1U << 5)
+#define SOLDERING_MODEL_SETPOINT_EDITED (1U << 6)
+#define SOLDERING_MODEL_BLINK           (1U << 7)
+#define SOLDERING_MODEL_ALL             0xFFU
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    SOLDERING_STATE_HEATING,        /*in use, regulating to the setpoint*/
+    SOLDERING_STATE_SLEEP,          /*in the holder, regulating to the sleep temperature*/
+    SOLDERING_STATE_TIP_REMOVED,
+    SOLDERING_STATE_NOT_CONNECTED,
+} SolderingState_t;
+
+typedef struct {
+    uint16_t SetPoint;          /*[°C] selected with the encoder*/
+    uint16_t ActiveSetPoint;    /*[°C] used by the regulator (limited in the holder)*/
+    uint16_t TipTemperature;    /*[°C] filtered thermocouple temperature*/
+    uint8_t HeatingPower;       /*[%] filtered output duty*/
+    SolderingState_t State;
+    bool InHolder;
+    bool SetPointEdited;        /*the setpoint has been changed recently: show it instead of the sleep temperature*/
+    bool Blink;                 /*phase of the blinking texts*/
+} SolderingModel_t;
+
+/**
+ * Called when the model has changed
+ * @param changed mask of the changed fields (SOLDERING_MODEL_...)
+ * @param model the new state
+ * @param user_data as given to SolderingModel_AddObserver()
+ */
+typedef void (*SolderingModel_ObserverCb_t)(uint32_t changed, const SolderingModel_t * model, void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Publish a new state. The observers are called if any field has changed,
+ * after the first call with SOLDERING_MODEL_ALL.
+ * @param model the new state (copied)
+ * @return mask of the changed fields
+ */
+uint32_t SolderingModel_Update(const SolderingModel_t * model);
+
+/**
+ * Get the last published state
+ * @return pointer to the state (all zero before the first update)
+ */
+const SolderingModel_t * SolderingModel_Get(void);
+
+/**
+ * Register an observer
+ * @param cb the callback
+ * @param user_data passed to `cb`
+ * @return false: there are already SOLDERING_MODEL_OBSERVER_MAX observers
+ */
+bool SolderingModel_AddObserver(SolderingModel_ObserverCb_t cb, void * user_data);
+
+/**
+ * Unregister an observer added with the same callback and user data
+ * @param cb the callback
+ * @param user_data passed to `cb`
+ */
+void SolderingModel_RemoveObserver(SolderingModel_ObserverCb_t cb, void * user_data);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SOLDERINGMODEL_H */
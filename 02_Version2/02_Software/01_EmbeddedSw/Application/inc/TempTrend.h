@@ -0,0 +1,90 @@
+/**
+ * @file TempTrend.h
+ *
+ * History of the tip temperature for the trend view.
+ * The control loop adds every measurement (~9 Hz, one in 11 half waves of the mains)
+ * to a ring buffer. Every TEMP_TREND_BUCKET samples are also reduced to their
+ * minimum and maximum in a second, longer ring buffer, so a long window is read
+ * without going through every sample.
+ *
+ * One writer (InterruptTask) and one reader (GUI task): the samples are written
+ * before the counter, a sample is valid to read while it is not older than the buffer.
+ *
+ */
+
+#ifndef TEMPTREND_H
+#define TEMPTREND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef TEMP_TREND_SAMPLES
+#define TEMP_TREND_SAMPLES      512     /*raw samples kept, ~56 s*/
+#endif
+
+#define TEMP_TREND_BUCKET       16      /*samples in a min/max bucket*/
+
+#ifndef TEMP_TREND_BUCKETS
+#define TEMP_TREND_BUCKETS      320     /*min/max buckets kept, ~9.4 min*/
+#endif
+
+#define TEMP_TREND_PERIOD_MS    110     /*time between two samples*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint16_t min;   /*[°C]*/
+    uint16_t max;   /*[°C]*/
+} TempTrend_MinMax_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Add a measurement
+ * @param temperature   [°C] tip temperature, 0 if it can't be measured
+ */
+void TempTrend_Add(uint16_t temperature);
+
+/**
+ * Get the number of measurements added since the start
+ * @return the index of the next measurement
+ */
+uint32_t TempTrend_GetCount(void);
+
+/**
+ * Get the minimum and the maximum of consecutive measurements.
+ * Aligned multiples of TEMP_TREND_BUCKET are read from the buckets, anything else from the samples.
+ * @param first     index of the first measurement
+ * @param n         number of measurements (>= 1)
+ * @param res       store the result here
+ * @return          true: ok; false: not measured yet or not kept any more
+ */
+bool TempTrend_Get(uint32_t first, uint32_t n, TempTrend_MinMax_t * res);
+
+/**
+ * Forget every measurement
+ */
+void TempTrend_Clear(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TEMPTREND_H */
@@ -20,6 +20,7 @@ float ADCData = 0;
 float TEST_ADCData;
 float T_tc = 0;
 float T_amb = 20;
+float CalibrationOffset = 0;/*°C of the selected tip type*/
 float U_measured;
 const float U_seebeck = 26.2;
 const float VoltageMultiplier = 3.662; /*33000000/(4096*220)=3.662*/
@@ -35,6 +36,14 @@ uint8_t N = 5;
 float Kp = 1.7;
 float Ki = 0.15;
 float Kd = 0.5;
+/*gains of the built-in PID profiles, the first one is tuned through the UART*/
+const float PidProfileGains[SETTINGS_PID_PROFILE_NUM][3] = {
+	{0, 0, 0},				/*SETTINGS_KP, SETTINGS_KI, SETTINGS_KD*/
+	{1.0, 0.10, 0.30},		/*soft*/
+	{2.5, 0.20, 0.80},		/*firm*/
+};
+volatile bool UartGainsReceived=false;/*set by the UART, stored by the control layer*/
+uint16_t UartGains[3];
 float E0 = 0;
 float E1 = 0;
 float E2 = 0;
@@ -61,18 +70,15 @@ float Bias=0;
 bool SolderingIronIsInHolder;	/*1 if soldering iron is in the Holder*/
 bool SolderingTipIsRemoved=false;/*new PCB version can distinguish removed tip and unconnected soldering iron*/
 bool SolderingIronNotConnected;/*1 if soldering iron unconnected*/
-extern WM_HWIN hDialog;		/**/
-extern WM_HWIN hText_0;		/*Set Temperature*/
-extern WM_HWIN hText_1;		/*setpoint*/
-extern WM_HWIN hText_2;		/*°C*/
-extern WM_HWIN hText_3;		/*Soldering Iron Temperature*/
-extern WM_HWIN hText_4;		/*actual temp*/
-extern WM_HWIN hText_5;		/*°C*/
-extern WM_HWIN hText_6;		/*Heating power*/
-extern WM_HWIN hProgbar_0;	/*progress bar*/
+/*preset and sleep variables*/
+uint8_t ActivePreset=0;
+uint32_t InHolderTick;
+/*backlight variables*/
+volatile bool UserActivity=false;/*set by the button and the holder, cleared by the backlight handler*/
+uint32_t BacklightEncoderValue;
 /*Flash variables*/
 bool FlashWriteEnabled=true;
-uint16_t VirtAddVarTab;
+uint16_t VirtAddVarTab[NB_OF_VAR];
 /**/
 uint16_t Counter = 0;
 uint8_t Cnt2=0;
@@ -84,7 +90,7 @@ bool CounterFlag = false;
 #define TemperatureMovingAverageCoeff2 		(1-TemperatureMovingAverageCoeff1)
 #define OutputDutyFilterCoeff1 				0.5									/*must be between 0 and 1*/
 #define OutputDutyFilterCoeff2 				(1-OutputDutyFilterCoeff1)
-#define EncoderOffset 						0x7FFF
+#define SetPointStep 						10									/*°C per encoder step*/
 /**/
 /*#define SendMeasurementsTimer*/
 #ifdef SendMeasurementsTimer
@@ -228,7 +234,7 @@ void InterruptTaskHandler(uint16_t GPIO_Pin)
 					OutputState = true;
 					/*convert to celsius*/
 					U_measured = ADCData * VoltageMultiplier; /*measured TC voltage in microvolts = Uadc(LSB) *3.662*/
-					T_tc = (U_measured / U_seebeck) + T_amb; /*Termocoulpe temperature=Measured voltage/seebeck voltage+Ambient temperature (cold junction compensation)*/
+					T_tc = (U_measured / U_seebeck) + T_amb + CalibrationOffset; /*Termocoulpe temperature=Measured voltage/seebeck voltage+Ambient temperature (cold junction compensation)+tip calibration*/
 					MovingAverage_T_tc = (uint16_t)(T_tc * TemperatureMovingAverageCoeff1 + MovingAverage_T_tc * TemperatureMovingAverageCoeff2);/*exponential filter with 2 sample and lambda=0.8*/
 					MovingAverage_T_tc = ((MovingAverage_T_tc + 4) / 5) * 5;/*rounding to 0 or 5 MovingAverage_T_tc=T_tc;*/
 					if (MovingAverage_T_tc > SetPoint * 1.1)
@@ -236,6 +242,7 @@ void InterruptTaskHandler(uint16_t GPIO_Pin)
 						OutputState = false;
 					}
 				}
+				TempTrend_Add(SolderingTipIsRemoved ? 0 : MovingAverage_T_tc);/*history of the trend view*/
 				if(FirstRunCounter < NumberOfADCSampleAvegrage)
 				{
 					OutputState = false;
@@ -307,54 +314,21 @@ void InterruptTaskHandler(uint16_t GPIO_Pin)
 /*Encoder Button External Interrupt*/
 	if (GPIO_Pin == ENC_BUT_Pin)
 		{
+		UserActivity=true;/*wakes up the display*/
 		if (HAL_GPIO_ReadPin(ENC_BUT_GPIO_Port, ENC_BUT_Pin) == 0)  /*if GPIO==0 -> falling edge*/
 		{
+			Encoder_ButtonEvent(true);/*to the GUI task*/
 		}
 		if (HAL_GPIO_ReadPin(ENC_BUT_GPIO_Port, ENC_BUT_Pin) == 1)  /*rising edge*/
 		{
-			/*store actual encoder value to flash*/
-			if (FlashWriteEnabled)
-			{
-				ChangedEncoderValueOnScreen=ChangedEncoderValueOnScreenPeriod;
-				uint16_t tmpWrite = SetPointBackup / 10;
-				uint16_t tmpRead;
-				if((EE_ReadVariable(0x0001,  &tmpRead)) != HAL_OK)
-				{
-					Error_Handler();
-				}
-				if (tmpRead != tmpWrite)
-				{
-					if((EE_WriteVariable(0x0001,  tmpWrite)) != HAL_OK)
-					{
-						Error_Handler();
-					}
-					if((EE_ReadVariable(0x0001,  &tmpRead)) != HAL_OK)
-					{
-						Error_Handler();
-					}
-					if (tmpWrite != tmpRead)
-					{
-						/*flash write error*/
-						asm("nop");/*debugnop*/
-					}
-					else
-					{
-						/*flash write ok*/
-						asm("nop");/*debugnop*/
-					}
-				}
-			}
-			else
-			{
-				asm("nop");/*debugnop*/
-			}
+			Encoder_ButtonEvent(false);/*the settings are stored by the control layer when settled*/
 		}
 	}
 /*----------------------------------------------------------------------------------------------*/
 /*Sleep Pin External Interrupt*/
 	if (GPIO_Pin == SLEEP_Pin)
 	{
-
+		UserActivity=true;/*iron taken out of or put into the holder*/
 	}
 }
 /*system timer 1ms*/
@@ -384,6 +358,20 @@ void TimerCallback_1ms(void)
 	}
 #endif
 }
+/*display backlight: dimmed in the holder, off after a long rest (see LcdBacklight.c)*/
+/*called from the GUI task which owns the display bus*/
+void BacklightHandler(void)
+{
+	bool InHolder=(HAL_GPIO_ReadPin(SLEEP_GPIO_Port,SLEEP_Pin)==1);
+	bool Activity=UserActivity;
+	UserActivity=false;
+	if(TIM2->CNT!=BacklightEncoderValue)/*encoder turned*/
+	{
+		BacklightEncoderValue=TIM2->CNT;
+		Activity=true;
+	}
+	LcdBacklight_Handler(InHolder, Activity, HAL_GetTick());
+}
 /*Uart functions*/
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
@@ -435,21 +423,11 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 				UartRxData[37]=='\r' &&
 				UartRxData[38]=='\n' )
 		{
-			Kp=(UartRxData[10]-'0')+(0.1*(UartRxData[12]-'0'))+(0.01*(UartRxData[13]-'0'));
-			Ki=(UartRxData[19]-'0')+(0.1*(UartRxData[21]-'0'))+(0.01*(UartRxData[22]-'0'));
-			Kd=(UartRxData[28]-'0')+(0.1*(UartRxData[30]-'0'))+(0.01*(UartRxData[31]-'0'));
-			if((EE_WriteVariable(0x0002,  (uint16_t)(Kp*100))) != HAL_OK)
-			{
-				Error_Handler();
-			}
-			if((EE_WriteVariable(0x0003,  (uint16_t)(Ki*100))) != HAL_OK)
-			{
-				Error_Handler();
-			}
-			if((EE_WriteVariable(0x0004,  (uint16_t)(Kd*100))) != HAL_OK)
-			{
-				Error_Handler();
-			}
+			/*in 1/100, applied and stored by ControlHandler()*/
+			UartGains[0]=(UartRxData[10]-'0')*100+(UartRxData[12]-'0')*10+(UartRxData[13]-'0');
+			UartGains[1]=(UartRxData[19]-'0')*100+(UartRxData[21]-'0')*10+(UartRxData[22]-'0');
+			UartGains[2]=(UartRxData[28]-'0')*100+(UartRxData[30]-'0')*10+(UartRxData[31]-'0');
+			UartGainsReceived=true;
 		}
 		else
 		{
@@ -468,19 +446,26 @@ void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
 	}
 }
 /**/
-void StateMachine(void)
+/*control layer: reads the inputs, sets the setpoint of the regulator and publishes the state to the views*/
+/*called from the GUI task*/
+void ControlHandler(void)
 {
+	SolderingModel_t Model;
+	int32_t EncoderSteps;
+	bool Sleeping;
+	/**/
 	if(HAL_GPIO_ReadPin(SLEEP_GPIO_Port,SLEEP_Pin)==1)
 	{
+		if(SolderingIronIsInHolder==false)
+		{
+			InHolderTick=HAL_GetTick();/*the sleep delay starts*/
+		}
 		SolderingIronIsInHolder=true;/*Soldering iron is in the holder*/
 	}
 	else
 	{
 		SolderingIronIsInHolder=false;/*Soldering iron is not in the holder*/
 	}
-	/*locals*/
-	char TmpStr[5];
-	uint16_t EncoderReadValue;
 	/**/
 	if(HAL_GPIO_ReadPin(SNC_GPIO_Port,SNC_Pin)==1)/*soldering iron is connected*/
 	{
@@ -491,145 +476,127 @@ void StateMachine(void)
 		SolderingIronNotConnected=true;
 	}
 	/**/
-	if(TIM2->CNT<0x8009)/*if encoder less than 0x7FFF+0x000A=0x8009 - 100°C*/
+	Encoder_Update(TIM2->CNT,HAL_GetTick());/*accelerated steps*/
+	EncoderSteps=Encoder_TakeSteps(ENCODER_TARGET_SETPOINT);/*0 while the GUI uses the encoder*/
+	if(EncoderSteps!=0)
 	{
-		TIM2->CNT=0x8009;/*low level saturation at 0x8009*/
+		/*saturated by the settings store*/
+		if(Settings_Set(SETTINGS_SETPOINT,SetPointBackup+EncoderSteps*SetPointStep))
+		{
+			ChangedEncoderValueOnScreen=ChangedEncoderValueOnScreenPeriod;
+		}
 	}
-	if(TIM2->CNT>0x802C)/*if encoder bigger than 0x7FFF+0x002D=0x802C - 450°C*/
+	if(UartGainsReceived==true)
 	{
-		TIM2->CNT=0x802C;/*top level saturation at 0x802C*/
+		UartGainsReceived=false;
+		Settings_Set(SETTINGS_KP,UartGains[0]);
+		Settings_Set(SETTINGS_KI,UartGains[1]);
+		Settings_Set(SETTINGS_KD,UartGains[2]);
 	}
-	EncoderReadValue=(TIM2->CNT-0x7FFF)*10;
-	if(EncoderReadValue!=SetPointBackup)
+	ApplySettings();
+	/**/
+	Sleeping=(SolderingTipIsRemoved==false && SolderingIronNotConnected==false && SolderingIronIsInHolder==true &&
+			(HAL_GetTick()-InHolderTick)>=(uint32_t)Settings_Get(SETTINGS_SLEEP_DELAY)*1000);
+	if(Sleeping==true && SetPointBackup>Settings_Get(SETTINGS_SLEEP_TEMPERATURE))
 	{
-		ChangedEncoderValueOnScreen=ChangedEncoderValueOnScreenPeriod;
+		SetPoint=Settings_Get(SETTINGS_SLEEP_TEMPERATURE);
 	}
-	SetPointBackup=EncoderReadValue;/*setpoint is 10*Encoder data-EncoderOffset*/
-	/**/
-	if(SolderingTipIsRemoved==true||SolderingIronNotConnected==true)
+	else
 	{
-		PROGBAR_SetValue(hProgbar_0, 0);/*output duty*/
-		if(CounterFlag){
-			TEXT_SetText(hText_4, "0");
-			if(SolderingTipIsRemoved==true)
-			{
-				TEXT_SetText(hText_6, "Soldering tip is removed!");
-			}
-			if(SolderingIronNotConnected==true)
-			{
-				TEXT_SetText(hText_6, "Soldering iron is not connected!");
-			}
-		}
-		else
-		{
-			TEXT_SetText(hText_4, " ");
-			TEXT_SetText(hText_6, " ");
-		}
-		/**/
-	    TEXT_SetText(hText_0, "Soldering\n Temperature");
-		sprintf(TmpStr,"%u",SetPointBackup);
-		TEXT_SetText(hText_2, TmpStr);
 		SetPoint=SetPointBackup;
 	}
-	else
+	/*publish*/
+	Model.SetPoint=SetPointBackup;
+	Model.ActiveSetPoint=SetPoint;
+	Model.TipTemperature=MovingAverage_T_tc;
+	Model.HeatingPower=OutputDutyFiltered;
+	if(SolderingIronNotConnected==true)
 	{
-		TEXT_SetText(hText_6, "Heating Power");
-		PROGBAR_SetValue(hProgbar_0, OutputDutyFiltered);/*output duty*/
-		sprintf(TmpStr,"%u",MovingAverage_T_tc);/*Soldering iron tip temperature*/
-		TEXT_SetText(hText_4, TmpStr);
-		/**/
-		if(SolderingIronIsInHolder == true)
-		{
-			if(SetPointBackup>150)
-			{
-				SetPoint=150;
-			}
-			else
-			{
-				SetPoint=SetPointBackup;
-			}
-			if(ChangedEncoderValueOnScreen>0)
-			{
-			    TEXT_SetText(hText_0, "Soldering\n Temperature");
-				sprintf(TmpStr,"%u",SetPointBackup);
-				TEXT_SetText(hText_2, TmpStr);
-			}
-			else
-			{
-				if(CounterFlag)
-				{
-				    TEXT_SetText(hText_0, "Soldering\n Temperature");
-					sprintf(TmpStr,"%u",SetPointBackup);
-					TEXT_SetText(hText_2, TmpStr);
-				}
-				else
-				{
-				    TEXT_SetText(hText_0, "Sleep\n Temperature");
-				    sprintf(TmpStr,"%u",SetPoint);
-				    TEXT_SetText(hText_2, TmpStr);/*sleep temperature*/
-				}
-			}
-		}
-		else
-		{
-		    TEXT_SetText(hText_0, "Soldering\n Temperature");
-			sprintf(TmpStr,"%u",SetPointBackup);
-			TEXT_SetText(hText_2, TmpStr);
-			SetPoint=SetPointBackup;
-		}
+		Model.State=SOLDERING_STATE_NOT_CONNECTED;
 	}
-}
-/**/
-void MainInit(void)
-{
-	uint16_t tmp = 0;
-	HAL_TIM_Encoder_Start(&htim2,TIM_CHANNEL_ALL);/*encoder timer2*/
-	/*read stored temperature value from flash*/
-	HAL_FLASH_Unlock();
-	if (EE_Init() != EE_OK)
+	else if(SolderingTipIsRemoved==true)
 	{
-		Error_Handler();
+		Model.State=SOLDERING_STATE_TIP_REMOVED;
 	}
-	if ((EE_ReadVariable(0x0001, &tmp)) == HAL_OK)
+	else if(Sleeping==true)
 	{
-		TIM2->CNT = (uint8_t) tmp + EncoderOffset;
+		Model.State=SOLDERING_STATE_SLEEP;
 	}
 	else
 	{
-		TIM2->CNT = 10 + EncoderOffset;/*safety default 100°C*/
-	}
-	if ((EE_ReadVariable(0x0002, &tmp)) == HAL_OK) /*Kp*/
+		Model.State=SOLDERING_STATE_HEATING;
+	}
+	Model.InHolder=SolderingIronIsInHolder;
+	Model.SetPointEdited=(ChangedEncoderValueOnScreen>0);
+	Model.Blink=CounterFlag;
+	SolderingModel_Update(&Model);
+	/*write-behind of the changed settings*/
+	if(FlashWriteEnabled==true && Settings_Handler(HAL_GetTick())==false)
 	{
-		Kp=tmp;
-		Kp/=100;
+		Error_Handler();
 	}
-	else
+}
+/*the settings used by the control loop*/
+void ApplySettings(void)
+{
+	uint8_t Profile=Settings_Get(SETTINGS_PID_PROFILE);
+	SetPointBackup=Settings_Get(SETTINGS_SETPOINT);
+	if(Profile==0)/*tuned*/
 	{
-		Kp=1.7;
+		Kp=Settings_Get(SETTINGS_KP)/100.0f;
+		Ki=Settings_Get(SETTINGS_KI)/100.0f;
+		Kd=Settings_Get(SETTINGS_KD)/100.0f;
 	}
-	/**/
-	if ((EE_ReadVariable(0x0003, &tmp)) == HAL_OK) /*Ki*/
+	else
 	{
-		Ki=tmp;
-		Ki/=100;
+		Kp=PidProfileGains[Profile][0];
+		Ki=PidProfileGains[Profile][1];
+		Kd=PidProfileGains[Profile][2];
 	}
-	else
+	CalibrationOffset=Settings_Get(SETTINGS_CAL_OFFSET_1+Settings_Get(SETTINGS_TIP_TYPE));
+}
+/*one click: the setpoint jumps to the next preset, stored when not changed for a while*/
+void SelectNextPreset(void)
+{
+	ActivePreset=(ActivePreset+1)%SETTINGS_PRESET_NUM;
+	Settings_Set(SETTINGS_SETPOINT,Settings_Get(SETTINGS_PRESET_1+ActivePreset));
+	SetPointBackup=Settings_Get(SETTINGS_SETPOINT);
+	ChangedEncoderValueOnScreen=ChangedEncoderValueOnScreenPeriod;
+}
+/*the EEPROM emulation behind the settings*/
+static bool SettingsRead(uint16_t Address, uint16_t *Value)
+{
+	return EE_ReadVariable(Address, Value)==HAL_OK;
+}
+static bool SettingsWrite(uint16_t Address, uint16_t Value)
+{
+	return EE_WriteVariable(Address, Value)==HAL_OK;
+}
+static const Settings_Storage_t SettingsStorage = {SettingsRead, SettingsWrite};
+/**/
+void MainInit(void)
+{
+	uint8_t i;
+	HAL_TIM_Encoder_Start(&htim2,TIM_CHANNEL_ALL);/*encoder timer2*/
+	/*read the stored settings from flash*/
+	if(NB_OF_VAR!=_SETTINGS_NUM)/*every setting has to survive the page transfer*/
 	{
-		Ki=0.15;
+		Error_Handler();
 	}
-	/**/
-	if ((EE_ReadVariable(0x0004, &tmp)) == HAL_OK) /*Kd*/
+	for(i=0;i<NB_OF_VAR;i++)
 	{
-		Kd=tmp;
-		Kd/=100;
+		VirtAddVarTab[i]=Settings_GetAddress(i);
 	}
-	else
+	HAL_FLASH_Unlock();
+	if (EE_Init() != EE_OK)
 	{
-		Kd=0.5;
+		Error_Handler();
 	}
+	Settings_Init(&SettingsStorage,HAL_GetTick());
+	ApplySettings();
 	/**/
 	HAL_UART_Receive_IT(&huart2, (uint8_t*)UartRxData, 39);
-	SetPointBackup=(TIM2->CNT-0x7FFF)*10;
+	Encoder_Init(TIM2->CNT,HAL_GetTick());/*the counter is relative, the setpoint is kept in SetPointBackup*/
 	/**/
 	HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);/*enable zero crossing interrupt*/
 }
@@ -0,0 +1,138 @@
+/**
+ * @file Encoder.c
+ *
+ * Acceleration: the time between two detents selects a multiplier, so a slow turn
+ * moves the setpoint by one step per detent and a fast spin crosses the range quickly.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "Encoder.h"
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t interval;      /*[ms] detents closer than this...*/
+    int32_t factor;         /*...are multiplied by this*/
+} accel_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static int32_t accel_factor(uint32_t interval);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*From the fastest*/
+static const accel_t accel[] = {
+    {20, 8},
+    {40, 4},
+    {80, 2},
+};
+
+static uint16_t last_cnt;
+static uint32_t last_move;      /*[ms] time of the last detent*/
+static Encoder_Target_t target;
+static int32_t steps;
+
+/*Written only by the InterruptTask (head) and the GUI task (tail)*/
+static volatile bool button_queue[ENCODER_BUTTON_QUEUE_SIZE];
+static volatile uint32_t button_head;
+static volatile uint32_t button_tail;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void Encoder_Init(uint16_t cnt, uint32_t tick)
+{
+    last_cnt = cnt;
+    last_move = tick;
+    target = ENCODER_TARGET_SETPOINT;
+    steps = 0;
+}
+
+void Encoder_Update(uint16_t cnt, uint32_t tick)
+{
+    int32_t diff = (int16_t)(uint16_t)(cnt - last_cnt);   /*the counter wraps around*/
+    uint32_t interval;
+
+    if(diff == 0) return;
+
+    interval = (tick - last_move) / (uint32_t)(diff > 0 ? diff : -diff);
+    steps += diff * accel_factor(interval);
+    last_cnt = cnt;
+    last_move = tick;
+}
+
+void Encoder_SetTarget(Encoder_Target_t new_target)
+{
+    if(target == new_target) return;
+
+    target = new_target;
+    steps = 0;
+}
+
+int32_t Encoder_TakeSteps(Encoder_Target_t caller)
+{
+    int32_t res;
+
+    if(caller != target) return 0;
+
+    res = steps;
+    steps = 0;
+    return res;
+}
+
+bool Encoder_HasSteps(Encoder_Target_t caller)
+{
+    return caller == target && steps != 0;
+}
+
+void Encoder_ButtonEvent(bool pressed)
+{
+    uint32_t head = button_head;
+
+    if(head - button_tail >= ENCODER_BUTTON_QUEUE_SIZE) return;   /*full: drop the edge*/
+
+    button_queue[head % ENCODER_BUTTON_QUEUE_SIZE] = pressed;
+    button_head = head + 1;
+}
+
+bool Encoder_GetButtonEvent(bool * pressed)
+{
+    uint32_t tail = button_tail;
+
+    if(tail == button_head) return false;
+
+    *pressed = button_queue[tail % ENCODER_BUTTON_QUEUE_SIZE];
+    button_tail = tail + 1;
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static int32_t accel_factor(uint32_t interval)
+{
+    size_t i;
+
+    for(i = 0; i < sizeof(accel) / sizeof(accel[0]); i++) {
+        if(interval < accel[i].interval) return accel[i].factor;
+    }
+    return 1;
+}
@@ -0,0 +1,217 @@
+/**
+ * @file Settings.c
+ *
+ * The storage keeps 16 bit words: a setting is stored divided by its resolution
+ * (e.g. the setpoint in 10 °C units at 0x0001, as the earlier firmware did) and
+ * the negative values as two's complement.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "Settings.h"
+#include <stddef.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint16_t addr;          /*virtual address in the storage*/
+    int16_t resolution;     /*the value is a multiple of it, stored divided by it*/
+    int16_t def;
+    int16_t min;
+    int16_t max;
+} setting_dsc_t;
+
+typedef struct {
+    int32_t value;          /*the cache*/
+    int32_t stored;         /*in the storage (or the default if it's not stored)*/
+    uint32_t changed;       /*[ms] time of the last change*/
+    bool dirty;             /*value has to be compared to stored*/
+} setting_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool flush(Settings_Id_t id);
+static int32_t clamp(Settings_Id_t id, int32_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const setting_dsc_t dsc[_SETTINGS_NUM] = {
+    [SETTINGS_SETPOINT]             = {0x0001, 10, 100, 100, 450},
+    [SETTINGS_KP]                   = {0x0002, 1, 170, 0, 999},
+    [SETTINGS_KI]                   = {0x0003, 1, 15, 0, 999},
+    [SETTINGS_KD]                   = {0x0004, 1, 50, 0, 999},
+    [SETTINGS_PRESET_1]             = {0x0005, 10, 250, 100, 450},
+    [SETTINGS_PRESET_1 + 1]         = {0x0006, 10, 320, 100, 450},
+    [SETTINGS_PRESET_1 + 2]         = {0x0007, 10, 380, 100, 450},
+    [SETTINGS_SLEEP_TEMPERATURE]    = {0x0008, 10, 150, 100, 300},
+    [SETTINGS_SLEEP_DELAY]          = {0x0009, 1, 0, 0, 600},
+    [SETTINGS_TIP_TYPE]             = {0x000A, 1, 0, 0, SETTINGS_TIP_NUM - 1},
+    [SETTINGS_PID_PROFILE]          = {0x000B, 1, 0, 0, SETTINGS_PID_PROFILE_NUM - 1},
+    [SETTINGS_CAL_OFFSET_1]         = {0x000C, 1, 0, -50, 50},
+    [SETTINGS_CAL_OFFSET_1 + 1]     = {0x000D, 1, 0, -50, 50},
+    [SETTINGS_CAL_OFFSET_1 + 2]     = {0x000E, 1, 0, -50, 50},
+};
+
+static const Settings_Storage_t * storage;
+static setting_t settings[_SETTINGS_NUM];
+static uint32_t last_tick;
+static Settings_Stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void Settings_Init(const Settings_Storage_t * new_storage, uint32_t tick)
+{
+    uint32_t i;
+
+    storage = new_storage;
+    last_tick = tick;
+    memset(settings, 0, sizeof(settings));
+
+    for(i = 0; i < _SETTINGS_NUM; i++) {
+        int32_t value = dsc[i].def;
+        uint16_t raw;
+
+        if(storage->read(dsc[i].addr, &raw)) {
+            int32_t v = (int16_t)raw * dsc[i].resolution;
+            if(v >= dsc[i].min && v <= dsc[i].max) value = v;
+        }
+        settings[i].value = value;
+        settings[i].stored = value;
+    }
+}
+
+int32_t Settings_Get(Settings_Id_t id)
+{
+    if(id >= _SETTINGS_NUM) return 0;
+    return settings[id].value;
+}
+
+bool Settings_Set(Settings_Id_t id, int32_t value)
+{
+    if(id >= _SETTINGS_NUM) return false;
+
+    value = clamp(id, value);
+    if(value == settings[id].value) return false;
+
+    settings[id].value = value;
+    settings[id].changed = last_tick;
+    settings[id].dirty = true;
+    return true;
+}
+
+void Settings_GetRange(Settings_Id_t id, int32_t * min, int32_t * max)
+{
+    if(id >= _SETTINGS_NUM) return;
+    if(min) *min = dsc[id].min;
+    if(max) *max = dsc[id].max;
+}
+
+uint16_t Settings_GetAddress(Settings_Id_t id)
+{
+    if(id >= _SETTINGS_NUM) return 0;
+    return dsc[id].addr;
+}
+
+bool Settings_Handler(uint32_t tick)
+{
+    bool ok = true;
+    uint32_t i;
+
+    last_tick = tick;
+    for(i = 0; i < _SETTINGS_NUM; i++) {
+        if(settings[i].dirty && tick - settings[i].changed >= SETTINGS_FLUSH_DELAY) {
+            if(!flush(i)) ok = false;
+        }
+    }
+    return ok;
+}
+
+bool Settings_Flush(void)
+{
+    bool ok = true;
+    uint32_t i;
+
+    for(i = 0; i < _SETTINGS_NUM; i++) {
+        if(settings[i].dirty && !flush(i)) ok = false;
+    }
+    return ok;
+}
+
+bool Settings_IsDirty(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < _SETTINGS_NUM; i++) {
+        if(settings[i].dirty) return true;
+    }
+    return false;
+}
+
+const Settings_Stats_t * Settings_GetStats(void)
+{
+    return &stats;
+}
+
+void Settings_ClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Write a dirty setting if it differs from the stored value.
+ * On error it stays dirty and is retried SETTINGS_FLUSH_DELAY later.
+ */
+static bool flush(Settings_Id_t id)
+{
+    setting_t * s = &settings[id];
+
+    if(s->value == s->stored) {
+        stats.skipped++;
+    }
+    else if(storage->write(dsc[id].addr, (uint16_t)(int16_t)(s->value / dsc[id].resolution))) {
+        s->stored = s->value;
+        stats.writes++;
+    }
+    else {
+        s->changed = last_tick;
+        stats.errors++;
+        return false;
+    }
+
+    s->dirty = false;
+    return true;
+}
+
+/**
+ * Limit a value to the range of a setting and round it to the resolution
+ */
+static int32_t clamp(Settings_Id_t id, int32_t value)
+{
+    int32_t res = dsc[id].resolution;
+
+    if(value < dsc[id].min) value = dsc[id].min;
+    if(value > dsc[id].max) value = dsc[id].max;
+
+    value = (value >= 0 ? value + res / 2 : value - res / 2) / res * res;
+    return value;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file SolderingModel.c
+ *
+ * Change notification between the control layer and the views.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "SolderingModel.h"
+#include <stddef.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    SolderingModel_ObserverCb_t cb;
+    void * user_data;
+} observer_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static SolderingModel_t current;
+static bool published;
+static observer_t observers[SOLDERING_MODEL_OBSERVER_MAX];
+
+/**********************
+ *      MACROS
+ **********************/
+#define FIELD_DIFF(field, bit)  (current.field != model->field ? (bit) : 0U)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t SolderingModel_Update(const SolderingModel_t * model)
+{
+    uint32_t changed;
+    uint32_t i;
+
+    if(published) {
+        changed = FIELD_DIFF(SetPoint, SOLDERING_MODEL_SETPOINT) |
+                  FIELD_DIFF(ActiveSetPoint, SOLDERING_MODEL_ACTIVE_SETPOINT) |
+                  FIELD_DIFF(TipTemperature, SOLDERING_MODEL_TIP_TEMPERATURE) |
+                  FIELD_DIFF(HeatingPower, SOLDERING_MODEL_HEATING_POWER) |
+                  FIELD_DIFF(State, SOLDERING_MODEL_STATE) |
+                  FIELD_DIFF(InHolder, SOLDERING_MODEL_IN_HOLDER) |
+                  FIELD_DIFF(SetPointEdited, SOLDERING_MODEL_SETPOINT_EDITED) |
+                  FIELD_DIFF(Blink, SOLDERING_MODEL_BLINK);
+    }
+    else {
+        changed = SOLDERING_MODEL_ALL;
+        published = true;
+    }
+
+    if(changed == 0) return 0;
+
+    current = *model;
+    for(i = 0; i < SOLDERING_MODEL_OBSERVER_MAX; i++) {
+        if(observers[i].cb) observers[i].cb(changed, &current, observers[i].user_data);
+    }
+
+    return changed;
+}
+
+const SolderingModel_t * SolderingModel_Get(void)
+{
+    return &current;
+}
+
+bool SolderingModel_AddObserver(SolderingModel_ObserverCb_t cb, void * user_data)
+{
+    uint32_t i;
+    for(i = 0; i < SOLDERING_MODEL_OBSERVER_MAX; i++) {
+        if(observers[i].cb == NULL) {
+            observers[i].cb = cb;
+            observers[i].user_data = user_data;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SolderingModel_RemoveObserver(SolderingModel_ObserverCb_t cb, void * user_data)
+{
+    uint32_t i;
+    for(i = 0; i < SOLDERING_MODEL_OBSERVER_MAX; i++) {
+        if(observers[i].cb == cb && observers[i].user_data == user_data) {
+            observers[i].cb = NULL;
+            observers[i].user_data = NULL;
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,106 @@
+/**
+ * @file TempTrend.c
+ *
+ * Ring buffers of the tip temperature and of its min/max buckets.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "TempTrend.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static volatile uint16_t samples[TEMP_TREND_SAMPLES];
+static volatile TempTrend_MinMax_t buckets[TEMP_TREND_BUCKETS];
+static volatile uint32_t count;     /*written after the buffers*/
+static TempTrend_MinMax_t acc;      /*bucket being filled, used only by the writer*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void TempTrend_Add(uint16_t temperature)
+{
+    uint32_t i = count;
+
+    samples[i % TEMP_TREND_SAMPLES] = temperature;
+
+    if(i % TEMP_TREND_BUCKET == 0) {
+        acc.min = temperature;
+        acc.max = temperature;
+    }
+    else {
+        if(temperature < acc.min) acc.min = temperature;
+        if(temperature > acc.max) acc.max = temperature;
+    }
+    if(i % TEMP_TREND_BUCKET == TEMP_TREND_BUCKET - 1) {
+        buckets[(i / TEMP_TREND_BUCKET) % TEMP_TREND_BUCKETS].min = acc.min;
+        buckets[(i / TEMP_TREND_BUCKET) % TEMP_TREND_BUCKETS].max = acc.max;
+    }
+
+    count = i + 1;
+}
+
+uint32_t TempTrend_GetCount(void)
+{
+    return count;
+}
+
+bool TempTrend_Get(uint32_t first, uint32_t n, TempTrend_MinMax_t * res)
+{
+    uint32_t cnt = count;
+    uint32_t i;
+
+    if(n == 0 || first + n > cnt || first + n < first) return false;
+
+    if(first % TEMP_TREND_BUCKET == 0 && n % TEMP_TREND_BUCKET == 0) {
+        uint32_t b = first / TEMP_TREND_BUCKET;
+        uint32_t b_end = b + n / TEMP_TREND_BUCKET;
+        if(cnt / TEMP_TREND_BUCKET - b > TEMP_TREND_BUCKETS) return false;
+
+        *res = buckets[b % TEMP_TREND_BUCKETS];
+        for(b++; b < b_end; b++) {
+            TempTrend_MinMax_t x = buckets[b % TEMP_TREND_BUCKETS];
+            if(x.min < res->min) res->min = x.min;
+            if(x.max > res->max) res->max = x.max;
+        }
+        return true;
+    }
+
+    if(cnt - first > TEMP_TREND_SAMPLES) return false;
+
+    res->min = samples[first % TEMP_TREND_SAMPLES];
+    res->max = res->min;
+    for(i = first + 1; i < first + n; i++) {
+        uint16_t t = samples[i % TEMP_TREND_SAMPLES];
+        if(t < res->min) res->min = t;
+        if(t > res->max) res->max = t;
+    }
+    return true;
+}
+
+void TempTrend_Clear(void)
+{
+    count = 0;
+    memset(&acc, 0, sizeof(acc));
+}
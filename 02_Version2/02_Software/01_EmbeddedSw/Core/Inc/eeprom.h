@@ -99,7 +99,7 @@
 #define PAGE_FULL             ((uint8_t)0x80)
 
 /* Variables' number */
-#define NB_OF_VAR             ((uint8_t)0x01)
+#define NB_OF_VAR             ((uint8_t)0x0E)  /* _SETTINGS_NUM of Settings.h */
 
 /* Exported types ------------------------------------------------------------*/
 /* Exported macro ------------------------------------------------------------*/
@@ -29,9 +29,15 @@
 #include "Application.h"
 #include "WindowDLG.h"
 #include "../../../lvgl/lvgl.h"
-#include "../../../lvgl/examples/lv_examples.h"
 #include "stdio.h"
-#include "ILI9341.h"
+#include "lv_port_disp.h"
+#include "lv_port_indev.h"
+#include "lv_port_cache.h"
+#include "lv_port_bench.h"
+#include "SolderingScreen.h"
+#include "TrendScreen.h"
+#include "SettingsScreen.h"
+#include "SolderingWindow.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -42,7 +48,9 @@
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
 #define LVGL
-#define BUFF_SIZE 512
+/*longest sleep of the GUI task [ms]: the encoder counter, the GPIOs and the model are polled, so it
+ *can't sleep till the next LVGL timer only; the same as LV_DISP_DEF_REFR_PERIOD*/
+#define GUI_POLL_PERIOD 30
 
 /* USER CODE END PD */
 
@@ -63,17 +71,13 @@ osThreadId MainTaskHandle;
 osThreadId GUI_TaskHandle;
 osThreadId InterruptTaskHandle;
 
-/*LVGL*/
-/*A static or global variable to store the buffers*/
-static lv_disp_draw_buf_t disp_buf;
-
-/*Static or global buffer(s). The second buffer is optional*/
-static lv_color_t buf_1[BUFF_SIZE]; //TODO: Declare your own BUFF_SIZE appropriate to your system.
-static lv_color_t buf_2[BUFF_SIZE];
-
 /* Private function prototypes -----------------------------------------------*/
 /* USER CODE BEGIN FunctionPrototypes */
-
+#if defined(LVGL) && !LV_PORT_BENCHMARK
+static void ShowView(lv_obj_t * View);
+static void ViewLongPressed(lv_event_t * e);
+static void SolderingViewClicked(lv_event_t * e);
+#endif
 /* USER CODE END FunctionPrototypes */
 
 void InitTask_Func(void const * argument);
@@ -227,38 +231,74 @@ void GUI_Task_Function(void const * argument)
 #ifdef LVGL
    lv_init();
    /*display driver init*/
-   LcdInit();
-
-   lv_disp_draw_buf_init(&disp_buf, buf_1, buf_2, BUFF_SIZE);
-
-   static lv_disp_drv_t disp_drv;          /*A variable to hold the drivers. Must be static or global.*/
-   lv_disp_drv_init(&disp_drv);            /*Basic initialization*/
-   disp_drv.draw_buf = &disp_buf;          /*Set an initialized buffer*/
-   disp_drv.flush_cb = ili9341_flush;        /*Set a flush callback to draw to the display*/
-   disp_drv.hor_res = ILI9341_TFTWIDTH;                 /*Set the horizontal resolution in pixels*/
-   disp_drv.ver_res = ILI9341_TFTHEIGHT;                 /*Set the vertical resolution in pixels*/
-   disp_drv.rotated = 2;
-
-   lv_disp_t * disp;
-   disp = lv_disp_drv_register(&disp_drv); /*Register the driver and save the created display objects*/
-
-   lv_example_anim_3();
-
+   lv_port_disp_init();
+   /*encoder input device init*/
+   lv_port_indev_init();
+   LcdBacklight_Init(HAL_GetTick());
+
+#if LV_PORT_BENCHMARK
+   /*benchmark build: the LVGL benchmark instead of the station screens, the results go to USART2*/
+   lv_port_bench_start();
    for(;;)
    {
 	   lv_task_handler();
 	   OsTaskCounterGUI_Task++;
-	   osDelay(10);
+	   osDelay(1);
+   }
+#else
+   lv_obj_t * SolderingScr=lv_scr_act();
+   lv_obj_t * TrendScr=lv_obj_create(NULL);
+   lv_obj_t * SettingsScr=lv_obj_create(NULL);
+   ControlHandler();/*publish the initial state before the screen reads it*/
+   lv_obj_t * SolderingView=SolderingScreen_Create(SolderingScr);
+   lv_obj_t * TrendView=TrendScreen_Create(TrendScr);
+   lv_obj_t * SettingsView=SettingsScreen_Create(SettingsScr);
+   /*open the images and compute the gradients now, not at the first switch to a screen*/
+   lv_port_cache_prewarm(SolderingScr);
+   lv_port_cache_prewarm(TrendScr);
+   lv_port_cache_prewarm(SettingsScr);
+   /*long press: soldering -> trend -> settings -> soldering; on the trend screen the encoder selects the window*/
+   lv_obj_add_event_cb(SolderingView, ViewLongPressed, LV_EVENT_LONG_PRESSED, TrendView);
+   lv_obj_add_event_cb(TrendView, ViewLongPressed, LV_EVENT_LONG_PRESSED, SettingsView);
+   lv_obj_add_event_cb(SettingsView, ViewLongPressed, LV_EVENT_LONG_PRESSED, SolderingView);
+   /*click: next temperature preset*/
+   lv_obj_add_event_cb(SolderingView, SolderingViewClicked, LV_EVENT_SHORT_CLICKED, NULL);
+   ShowView(SolderingView);
+
+   for(;;)
+   {
+	   /*the encoder sets the temperature on the soldering screen, elsewhere it drives the GUI*/
+	   Encoder_SetTarget(lv_scr_act()==SolderingScr ? ENCODER_TARGET_SETPOINT : ENCODER_TARGET_GUI);
+	   ControlHandler();/*the screen redraws what has changed*/
+	   lv_port_indev_process();
+	   uint32_t Wait=lv_task_handler();/*time till the next LVGL timer*/
+	   BacklightHandler();
+	   OsTaskCounterGUI_Task++;
+	   /*sleep till the next timer, the next poll or a button/sleep edge (InterruptTask)*/
+	   ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LV_CLAMP(1, Wait, GUI_POLL_PERIOD)));
 
    }
+#endif /*LV_PORT_BENCHMARK*/
 #else
   /* USER CODE BEGIN GUI_Task_Function */
 	Init_GUI();		/*initializing graphics*/
+	ControlHandler();
+	SolderingWindow_Init();/*the window follows the model from here*/
+	LcdBacklight_Init(HAL_GetTick());
   /* Infinite loop */
   for(;;)
   {
-	StateMachine();	/**/
-	GUI_Exec();		/*GUI execution*/
+	bool Pressed;
+	while(Encoder_GetButtonEvent(&Pressed))
+	{
+		if(Pressed==false)
+		{
+			SelectNextPreset();/*click: next temperature preset*/
+		}
+	}
+	ControlHandler();		/*publishes the changes to the window*/
+	SolderingWindow_Exec();	/*GUI execution*/
+	BacklightHandler();
 	OsTaskCounterGUI_Task++;
     osDelay(80);
   }
@@ -300,6 +340,13 @@ void InterruptTask_Func(void const * argument)
       }
 
       InterruptTaskHandler((uint16_t) (EXTI_PIN & 0xFFFF));
+#ifdef LVGL
+      /*wake the GUI now, not at its next poll*/
+      if(EXTI_PIN==ENC_BUT_Pin || EXTI_PIN==SLEEP_Pin)
+      {
+    	  xTaskNotifyGive(GUI_TaskHandle);
+      }
+#endif
 	  OsTaskCounterInterruptTask++;
   }
   /* USER CODE END InterruptTask_Func */
@@ -314,4 +361,24 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 	checkIfYieldRequired = xTaskResumeFromISR(InterruptTaskHandle);
 	portYIELD_FROM_ISR(checkIfYieldRequired);
 }
+#if defined(LVGL) && !LV_PORT_BENCHMARK
+/*the encoder controls only the view on the active screen*/
+static void ShowView(lv_obj_t * View)
+{
+	lv_group_t * Group=lv_port_indev_get_group();
+	lv_group_remove_all_objs(Group);
+	lv_group_add_obj(Group, View);
+	lv_group_set_editing(Group, true);/*rotation is sent as LV_KEY_LEFT/RIGHT*/
+	lv_scr_load(lv_obj_get_screen(View));
+}
+static void ViewLongPressed(lv_event_t * e)
+{
+	lv_obj_t * NextView=lv_event_get_user_data(e);
+	ShowView(NextView);
+}
+static void SolderingViewClicked(lv_event_t * e)
+{
+	SelectNextPreset();
+}
+#endif
 /* USER CODE END Application */
@@ -115,5 +115,12 @@ void HAL_UART_MspDeInit(UART_HandleTypeDef* uartHandle)
 }
 
 /* USER CODE BEGIN 1 */
+/* printf() ends here (_write() of syscalls.c), e.g. the results of the benchmark build */
+int __io_putchar(int ch)
+{
+  uint8_t c = (uint8_t)ch;
 
+  HAL_UART_Transmit(&huart2, &c, 1, HAL_MAX_DELAY);
+  return ch;
+}
 /* USER CODE END 1 */
@@ -0,0 +1,71 @@
+/**
+ * @file SettingsScreen.h
+ *
+ * LVGL settings screen: an lv_menu page with the temperature presets, the sleep,
+ * tip and control settings of the Settings store.
+ * It is driven by the keys of the encoder in edit mode like the other views:
+ * turning moves the selection, a click starts/ends changing the selected setting.
+ *
+ */
+
+#ifndef SETTINGSSCREEN_H
+#define SETTINGSSCREEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "Settings.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the settings screen (320x240 landscape). Only one instance can exist.
+ * LV_KEY_RIGHT/LV_KEY_LEFT and LV_EVENT_SHORT_CLICKED on the returned object control it.
+ * @param parent the parent, typically a screen created with lv_obj_create(NULL)
+ * @return the container of the screen
+ */
+lv_obj_t * SettingsScreen_Create(lv_obj_t * parent);
+
+/**
+ * Get the setting under the selection
+ * @return the setting
+ */
+Settings_Id_t SettingsScreen_GetSelected(void);
+
+/**
+ * Check if the selected setting is being changed
+ * @return true: the keys change the value; false: the keys move the selection
+ */
+bool SettingsScreen_IsEditing(void);
+
+/**
+ * Read the values shown again, e.g. after they were changed somewhere else
+ */
+void SettingsScreen_Refresh(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SETTINGSSCREEN_H */
@@ -0,0 +1,82 @@
+/**
+ * @file SolderingScreen.h
+ *
+ * LVGL soldering screen: setpoint, tip temperature, heating power, state banner
+ * and holder/sleep indicators. It follows SolderingModel and invalidates only
+ * the widgets (digits) whose value has changed.
+ *
+ */
+
+#ifndef SOLDERINGSCREEN_H
+#define SOLDERINGSCREEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include "lvgl.h"
+#include "SolderingModel.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SOLDERING_SCREEN_DIGITS     3       /*digits of the temperatures*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/*Widgets with redraw statistics. The digits of a temperature are counted together.*/
+typedef enum {
+    SOLDERING_SCREEN_CAPTION,       /*"Soldering/Sleep Temperature"*/
+    SOLDERING_SCREEN_SETPOINT,
+    SOLDERING_SCREEN_TIP,
+    SOLDERING_SCREEN_POWER,
+    SOLDERING_SCREEN_BANNER,
+    SOLDERING_SCREEN_HOLDER,
+    SOLDERING_SCREEN_SLEEP,
+    _SOLDERING_SCREEN_WIDGET_NUM
+} SolderingScreen_Widget_t;
+
+typedef struct {
+    uint32_t draws;         /*draw calls (a widget is drawn once per touched draw buffer)*/
+    uint32_t area;          /*[px] sum of the redrawn areas*/
+    uint32_t time_us;       /*[us] sum of the draw times*/
+} SolderingScreen_Stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the soldering screen (320x240 landscape) and start following SolderingModel.
+ * Only one instance can exist, deleting the returned object stops following the model.
+ * @param parent the parent, typically lv_scr_act()
+ * @return the container of the screen
+ */
+lv_obj_t * SolderingScreen_Create(lv_obj_t * parent);
+
+/**
+ * Get the redraw statistics of a widget collected since the last SolderingScreen_ClearStats()
+ * @param widget the widget
+ * @return pointer to the statistics
+ */
+const SolderingScreen_Stats_t * SolderingScreen_GetStats(SolderingScreen_Widget_t widget);
+
+/**
+ * Zero the redraw statistics
+ */
+void SolderingScreen_ClearStats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SOLDERINGSCREEN_H */
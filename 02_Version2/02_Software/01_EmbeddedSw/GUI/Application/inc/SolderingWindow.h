@@ -0,0 +1,75 @@
+/**
+ * @file SolderingWindow.h
+ *
+ * emWin view of the soldering screen (the dialog of WindowDLG.c).
+ * It follows SolderingModel and calls the emWin setters only when the shown
+ * value changes. The blinking texts are driven by a WM timer.
+ *
+ */
+
+#ifndef SOLDERINGWINDOW_H
+#define SOLDERINGWINDOW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef SOLDERING_WINDOW_BLINK_PERIOD
+#define SOLDERING_WINDOW_BLINK_PERIOD   750     /*[ms] period of the blinking texts*/
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t ticks;             /*SolderingWindow_Exec() calls*/
+    uint32_t set_calls;         /*TEXT_SetText(), PROGBAR_SetValue(), show/hide calls, changed digits*/
+    uint32_t paints;            /*WM_PAINT messages of the dialog and its widgets*/
+    uint32_t paint_time_us;     /*[us] sum of the paint times*/
+    uint32_t tick_time_us;      /*[us] sum of the GUI_Exec() times*/
+    uint32_t tick_time_max_us;  /*[us] longest GUI_Exec()*/
+} SolderingWindow_Stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start following SolderingModel. Init_GUI() has to be called before it.
+ */
+void SolderingWindow_Init(void);
+
+/**
+ * Let emWin redraw what has changed (GUI_Exec()) and measure it.
+ * Call it periodically from the GUI task.
+ */
+void SolderingWindow_Exec(void);
+
+/**
+ * Get the statistics collected since the last SolderingWindow_ClearStats()
+ * @return pointer to the statistics
+ */
+const SolderingWindow_Stats_t * SolderingWindow_GetStats(void);
+
+/**
+ * Zero the statistics
+ */
+void SolderingWindow_ClearStats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* SOLDERINGWINDOW_H */
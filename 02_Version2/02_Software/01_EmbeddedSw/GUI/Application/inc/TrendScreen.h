@@ -0,0 +1,96 @@
+/**
+ * @file TrendScreen.h
+ *
+ * LVGL trend screen: history of the tip temperature from TempTrend on an lv_chart.
+ * The chart sweeps in circular mode, a new column invalidates only a few pixel wide strip.
+ * A column shows the minimum and the maximum of the measurements it covers.
+ *
+ */
+
+#ifndef TRENDSCREEN_H
+#define TRENDSCREEN_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include "lvgl.h"
+#include "TempTrend.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define TREND_SCREEN_COLUMNS    272     /*width of the plot, one column per pixel*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    TREND_SCREEN_WINDOW_SHORT,      /*a measurement per column, ~30 s*/
+    TREND_SCREEN_WINDOW_LONG,       /*a min/max bucket per column, ~8 min*/
+    _TREND_SCREEN_WINDOW_NUM
+} TrendScreen_Window_t;
+
+typedef struct {
+    uint32_t columns;       /*columns added to the chart*/
+    uint32_t draws;         /*draw calls of the chart*/
+    uint32_t area;          /*[px] sum of the redrawn chart areas*/
+    uint32_t time_us;       /*[us] sum of the chart draw times*/
+} TrendScreen_Stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the trend screen (320x240 landscape). It reads the new measurements
+ * with an lv_timer. Only one instance can exist.
+ * LV_KEY_RIGHT/LV_KEY_LEFT on the returned object (the encoder in edit mode)
+ * select the long/short window.
+ * @param parent the parent, typically a screen created with lv_obj_create(NULL)
+ * @return the container of the screen
+ */
+lv_obj_t * TrendScreen_Create(lv_obj_t * parent);
+
+/**
+ * Select the time window. The chart is refilled from the history.
+ * @param window the window
+ */
+void TrendScreen_SetWindow(TrendScreen_Window_t window);
+
+/**
+ * Get the selected time window
+ * @return the window
+ */
+TrendScreen_Window_t TrendScreen_GetWindow(void);
+
+/**
+ * Add the columns completed since the last call to the chart.
+ * Called by the timer of the screen, can be called directly too.
+ */
+void TrendScreen_Refresh(void);
+
+/**
+ * Get the statistics collected since the last TrendScreen_ClearStats()
+ * @return pointer to the statistics
+ */
+const TrendScreen_Stats_t * TrendScreen_GetStats(void);
+
+/**
+ * Zero the statistics
+ */
+void TrendScreen_ClearStats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TRENDSCREEN_H */
@@ -9,7 +9,6 @@
 /*includes*/
 
 /*Function declarations*/
-extern void StateMachine(void);
 void Init_GUI(void);
 
 #endif /* APPLICATION_H_ */
@@ -0,0 +1,239 @@
+/**
+ * @file SettingsScreen.c
+ *
+ *   Presets
+ *   | Preset 1                    250 °C |   <- selected row
+ *   | Preset 2                    320 °C |
+ *   Sleep
+ *   | Temperature                 150 °C |
+ *   ...
+ *
+ * One lv_menu page with a section per group of settings and a row per setting.
+ * Only the container of the screen is in the group of the encoder (like the other
+ * views), the rows are not focusable: the selection is kept here and shown with
+ * LV_STATE_CHECKED, so the encoder doesn't have to navigate in the menu.
+ * A change goes to the Settings store at once, it writes the flash when settled.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "SettingsScreen.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCREEN_HOR_RES      320
+#define SCREEN_VER_RES      240
+
+#define COLOR_TEXT          lv_color_white()
+#define COLOR_SECTION_TEXT  lv_color_hex(0x808080)
+#define COLOR_ROW_BG        lv_color_hex(0x181818)
+#define COLOR_SELECTED_BG   lv_color_hex(0x404040)
+#define COLOR_EDITED        lv_color_hex(0xFF0000)
+
+#define FONT_TEXT           (&lv_font_montserrat_20)
+#define FONT_SECTION        (&lv_font_montserrat_14)
+
+#define ROW_NUM             10
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const char * section;           /*title of the section starting with this row or NULL*/
+    const char * text;
+    Settings_Id_t id;
+    int16_t step;                   /*change by a detent*/
+    const char * fmt;               /*format of the value*/
+    const char * const * options;   /*names of the values or NULL*/
+    const char * zero;              /*text of 0 or NULL*/
+} row_dsc_t;
+
+typedef struct {
+    lv_obj_t * root;
+    lv_obj_t * page;
+    lv_obj_t * conts[ROW_NUM];
+    lv_obj_t * values[ROW_NUM];
+    uint32_t selected;              /*index in `rows`*/
+    bool editing;
+} screen_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void select_row(uint32_t row);
+static void set_editing(bool editing);
+static void value_refresh(uint32_t row);
+static void root_event_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char * const tip_names[SETTINGS_TIP_NUM] = {"C245", "C210", "C115"};
+static const char * const profile_names[SETTINGS_PID_PROFILE_NUM] = {"Tuned", "Soft", "Firm"};
+
+static const row_dsc_t rows[ROW_NUM] = {
+    {"Presets", "Preset 1", SETTINGS_PRESET_1, 10, "%d °C", NULL, NULL},
+    {NULL, "Preset 2", SETTINGS_PRESET_1 + 1, 10, "%d °C", NULL, NULL},
+    {NULL, "Preset 3", SETTINGS_PRESET_1 + 2, 10, "%d °C", NULL, NULL},
+    {"Sleep", "Temperature", SETTINGS_SLEEP_TEMPERATURE, 10, "%d °C", NULL, NULL},
+    {NULL, "Delay", SETTINGS_SLEEP_DELAY, 10, "%d s", NULL, "Off"},
+    {"Tip", "Type", SETTINGS_TIP_TYPE, 1, NULL, tip_names, NULL},
+    {NULL, "C245 offset", SETTINGS_CAL_OFFSET_1, 1, "%+d °C", NULL, NULL},
+    {NULL, "C210 offset", SETTINGS_CAL_OFFSET_1 + 1, 1, "%+d °C", NULL, NULL},
+    {NULL, "C115 offset", SETTINGS_CAL_OFFSET_1 + 2, 1, "%+d °C", NULL, NULL},
+    {"Control", "PID profile", SETTINGS_PID_PROFILE, 1, NULL, profile_names, NULL},
+};
+
+static screen_t screen;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * SettingsScreen_Create(lv_obj_t * parent)
+{
+    lv_obj_t * section = NULL;
+    uint32_t i;
+
+    memset(&screen, 0, sizeof(screen));
+
+    lv_obj_t * root = lv_obj_create(parent);
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, SCREEN_HOR_RES, SCREEN_VER_RES);
+    lv_obj_set_style_bg_color(root, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(root, root_event_cb, LV_EVENT_ALL, NULL);
+    screen.root = root;
+
+    lv_obj_t * menu = lv_menu_create(root);
+    lv_obj_set_size(menu, SCREEN_HOR_RES, SCREEN_VER_RES);
+    lv_obj_set_style_bg_color(menu, lv_color_black(), 0);
+    lv_obj_set_style_text_color(menu, COLOR_TEXT, 0);
+    lv_obj_set_style_text_font(menu, FONT_TEXT, 0);
+
+    screen.page = lv_menu_page_create(menu, NULL);
+    lv_obj_set_scrollbar_mode(screen.page, LV_SCROLLBAR_MODE_OFF);
+
+    for(i = 0; i < ROW_NUM; i++) {
+        if(rows[i].section) {
+            lv_obj_t * title = lv_label_create(screen.page);
+            lv_obj_set_style_text_font(title, FONT_SECTION, 0);
+            lv_obj_set_style_text_color(title, COLOR_SECTION_TEXT, 0);
+            lv_obj_set_width(title, LV_PCT(100));
+            lv_obj_set_style_pad_left(title, 10, 0);
+            lv_label_set_text_static(title, rows[i].section);
+
+            section = lv_menu_section_create(screen.page);
+            lv_obj_set_style_bg_color(section, COLOR_ROW_BG, 0);
+        }
+
+        lv_obj_t * cont = lv_menu_cont_create(section);
+        lv_obj_clear_flag(cont, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_style_text_color(cont, COLOR_TEXT, 0);
+        lv_obj_set_style_text_color(cont, COLOR_TEXT, LV_STATE_CHECKED);  /*over the theme*/
+        lv_obj_set_style_bg_color(cont, COLOR_SELECTED_BG, LV_STATE_CHECKED);
+        lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, LV_STATE_CHECKED);
+
+        lv_obj_t * text = lv_label_create(cont);
+        lv_label_set_text_static(text, rows[i].text);
+        lv_obj_set_flex_grow(text, 1);
+
+        screen.values[i] = lv_label_create(cont);
+        lv_obj_set_style_text_color(screen.values[i], COLOR_EDITED, LV_STATE_EDITED);
+        screen.conts[i] = cont;
+        value_refresh(i);
+    }
+
+    lv_menu_set_page(menu, screen.page);
+    select_row(0);
+
+    return root;
+}
+
+Settings_Id_t SettingsScreen_GetSelected(void)
+{
+    return rows[screen.selected].id;
+}
+
+bool SettingsScreen_IsEditing(void)
+{
+    return screen.editing;
+}
+
+void SettingsScreen_Refresh(void)
+{
+    uint32_t i;
+
+    if(screen.root == NULL) return;
+
+    for(i = 0; i < ROW_NUM; i++) value_refresh(i);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Move the selection to a row and scroll it into view
+ */
+static void select_row(uint32_t row)
+{
+    lv_obj_clear_state(screen.conts[screen.selected], LV_STATE_CHECKED);
+    screen.selected = row;
+    lv_obj_add_state(screen.conts[row], LV_STATE_CHECKED);
+    lv_obj_scroll_to_view_recursive(screen.conts[row], LV_ANIM_OFF);
+}
+
+static void set_editing(bool editing)
+{
+    screen.editing = editing;
+    if(editing) lv_obj_add_state(screen.values[screen.selected], LV_STATE_EDITED);
+    else lv_obj_clear_state(screen.values[screen.selected], LV_STATE_EDITED);
+}
+
+static void value_refresh(uint32_t row)
+{
+    const row_dsc_t * dsc = &rows[row];
+    int32_t value = Settings_Get(dsc->id);
+
+    if(dsc->options) lv_label_set_text_static(screen.values[row], dsc->options[value]);
+    else if(dsc->zero && value == 0) lv_label_set_text_static(screen.values[row], dsc->zero);
+    else lv_label_set_text_fmt(screen.values[row], dsc->fmt, (int)value);
+}
+
+static void root_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if(code == LV_EVENT_KEY) {
+        uint32_t key = lv_event_get_key(e);
+        int32_t dir;
+
+        if(key == LV_KEY_RIGHT) dir = 1;
+        else if(key == LV_KEY_LEFT) dir = -1;
+        else return;
+
+        if(screen.editing) {
+            const row_dsc_t * dsc = &rows[screen.selected];
+            if(Settings_Set(dsc->id, Settings_Get(dsc->id) + dir * dsc->step)) value_refresh(screen.selected);
+        }
+        else {
+            select_row((screen.selected + ROW_NUM + dir) % ROW_NUM);
+        }
+    }
+    else if(code == LV_EVENT_SHORT_CLICKED) {
+        set_editing(!screen.editing);
+    }
+    else if(code == LV_EVENT_DELETE) {
+        memset(&screen, 0, sizeof(screen));
+    }
+}
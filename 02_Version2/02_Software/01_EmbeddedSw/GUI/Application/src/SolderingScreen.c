@@ -0,0 +1,394 @@
+/**
+ * @file SolderingScreen.c
+ *
+ * Layout (320x240, the same as the emWin WindowDLG.c):
+ *
+ *   HOLDER                                 SLEEP
+ *   Soldering      [3][2][0]  °C
+ *   Temperature
+ *   Tip            [3][1][5]  °C
+ *   Temperature
+ *   [======= heating power ======          ]
+ *                 state banner
+ *
+ * Every digit is a separate image of a pre-rendered RGB565 sprite (DigitSprites.c): drawing
+ * it is a row by row copy into the draw buffer, there is no font rasterization or blending.
+ * Every widget is touched only when the text/value it shows changes, so a steady state
+ * frame redraws only the changed digits.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "SolderingScreen.h"
+#include "Perf.h"
+#include "DigitSprites.h"
+#include "lv_port_cache.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCREEN_HOR_RES      320
+#define SCREEN_VER_RES      240
+
+#define ROW_SETPOINT_Y      24
+#define ROW_TIP_Y           92
+#define ROW_H               64
+#define CAPTION_W           130
+#define DIGIT_X             140
+#define DIGIT_PITCH         36
+#define UNIT_X              266
+
+#define POWER_X             10
+#define POWER_Y             168
+#define POWER_W             300
+#define POWER_H             24
+
+#define BANNER_Y            200
+#define BANNER_H            36
+
+#define COLOR_TEXT          lv_color_white()
+#define COLOR_ERROR         lv_color_hex(0xFF4020)
+#define COLOR_INDICATOR_ON  lv_color_hex(0xFFA000)
+#define COLOR_INDICATOR_OFF lv_color_hex(0x303030)
+#define COLOR_POWER         lv_color_hex(0xD42900)
+#define COLOR_POWER_BG      lv_color_hex(0x303030)
+
+#define FONT_TEXT           (&lv_font_montserrat_20)
+#define FONT_INDICATOR      (&lv_font_montserrat_14)
+
+#if DIGIT_SPRITES_16_SWAP != LV_COLOR_16_SWAP
+#error "The digit sprites and LVGL have different byte order, define DIGIT_SPRITES_16_SWAP for the project"
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_obj_t * cell[SOLDERING_SCREEN_DIGITS];
+    char shown[SOLDERING_SCREEN_DIGITS];        /*character in the cells, 0: empty*/
+    DigitSprite_Color_t color;
+} digits_t;
+
+typedef struct {
+    lv_obj_t * root;
+    lv_obj_t * caption;
+    lv_obj_t * power;
+    lv_obj_t * banner;
+    lv_obj_t * holder;
+    lv_obj_t * sleep;
+    digits_t setpoint;
+    digits_t tip;
+    /*what is on the screen, to leave the widgets alone if nothing changes*/
+    const char * caption_text;
+    const char * banner_text;
+    bool banner_error;
+    bool holder_on;
+    bool sleep_on;
+} screen_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void model_changed_cb(uint32_t changed, const SolderingModel_t * model, void * user_data);
+static void root_delete_cb(lv_event_t * e);
+static void stats_event_cb(lv_event_t * e);
+static void label_ext_draw_cb(lv_event_t * e);
+static lv_obj_t * text_create(lv_obj_t * parent, const lv_font_t * font, lv_coord_t x, lv_coord_t y, lv_coord_t w,
+                              lv_coord_t h, SolderingScreen_Widget_t widget);
+static void digits_create(digits_t * digits, lv_obj_t * parent, lv_coord_t y, DigitSprite_Color_t color,
+                          SolderingScreen_Widget_t widget);
+static void digits_set(digits_t * digits, uint32_t value, bool blank);
+static void unit_create(lv_obj_t * parent, lv_coord_t y);
+static void text_set(lv_obj_t * label, const char ** shown, const char * text);
+static void indicator_set(lv_obj_t * label, bool * shown, bool on);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static screen_t screen;
+static lv_img_dsc_t sprites[_DIGIT_SPRITE_COLOR_NUM][10];
+static SolderingScreen_Stats_t stats[_SOLDERING_SCREEN_WIDGET_NUM];
+static uint32_t draw_start;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * SolderingScreen_Create(lv_obj_t * parent)
+{
+    Perf_Init();
+    memset(&screen, 0, sizeof(screen));
+
+    lv_obj_t * root = lv_obj_create(parent);
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, SCREEN_HOR_RES, SCREEN_VER_RES);
+    lv_obj_set_style_bg_color(root, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(root, root_delete_cb, LV_EVENT_DELETE, NULL);
+    screen.root = root;
+
+    screen.holder = text_create(root, FONT_INDICATOR, 10, 2, 100, 18, SOLDERING_SCREEN_HOLDER);
+    lv_obj_set_style_text_align(screen.holder, LV_TEXT_ALIGN_LEFT, 0);
+    lv_obj_set_style_text_color(screen.holder, COLOR_INDICATOR_OFF, 0);
+    lv_label_set_text_static(screen.holder, "HOLDER");
+
+    screen.sleep = text_create(root, FONT_INDICATOR, SCREEN_HOR_RES - 110, 2, 100, 18, SOLDERING_SCREEN_SLEEP);
+    lv_obj_set_style_text_align(screen.sleep, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_style_text_color(screen.sleep, COLOR_INDICATOR_OFF, 0);
+    lv_label_set_text_static(screen.sleep, "SLEEP");
+
+    /*Two lines of FONT_TEXT centered in the row*/
+    lv_coord_t caption_h = 2 * lv_font_get_line_height(FONT_TEXT);
+    screen.caption = text_create(root, FONT_TEXT, 0, ROW_SETPOINT_Y + (ROW_H - caption_h) / 2, CAPTION_W,
+                                 caption_h, SOLDERING_SCREEN_CAPTION);
+    lv_obj_t * tip_caption = text_create(root, FONT_TEXT, 0, ROW_TIP_Y + (ROW_H - caption_h) / 2, CAPTION_W,
+                                         caption_h, _SOLDERING_SCREEN_WIDGET_NUM);
+    lv_label_set_text_static(tip_caption, "Tip\nTemperature");
+
+    digits_create(&screen.setpoint, root, ROW_SETPOINT_Y, DIGIT_SPRITE_WHITE, SOLDERING_SCREEN_SETPOINT);
+    digits_create(&screen.tip, root, ROW_TIP_Y, DIGIT_SPRITE_RED, SOLDERING_SCREEN_TIP);
+    unit_create(root, ROW_SETPOINT_Y);
+    unit_create(root, ROW_TIP_Y);
+
+    screen.power = lv_bar_create(root);
+    lv_obj_remove_style_all(screen.power);
+    lv_obj_set_pos(screen.power, POWER_X, POWER_Y);
+    lv_obj_set_size(screen.power, POWER_W, POWER_H);
+    lv_obj_set_style_bg_color(screen.power, COLOR_POWER_BG, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(screen.power, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(screen.power, COLOR_POWER, LV_PART_INDICATOR);
+    lv_obj_set_style_bg_opa(screen.power, LV_OPA_COVER, LV_PART_INDICATOR);
+    lv_bar_set_range(screen.power, 0, 100);
+    lv_obj_add_event_cb(screen.power, stats_event_cb, LV_EVENT_ALL, (void *)(uintptr_t)SOLDERING_SCREEN_POWER);
+
+    screen.banner = text_create(root, FONT_TEXT, 0, BANNER_Y + (BANNER_H - lv_font_get_line_height(FONT_TEXT)) / 2,
+                                SCREEN_HOR_RES, lv_font_get_line_height(FONT_TEXT), SOLDERING_SCREEN_BANNER);
+
+    /*Show the current state, then follow the changes*/
+    model_changed_cb(SOLDERING_MODEL_ALL, SolderingModel_Get(), NULL);
+    SolderingModel_AddObserver(model_changed_cb, NULL);
+
+    return root;
+}
+
+const SolderingScreen_Stats_t * SolderingScreen_GetStats(SolderingScreen_Widget_t widget)
+{
+    return &stats[widget];
+}
+
+void SolderingScreen_ClearStats(void)
+{
+    memset(stats, 0, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void model_changed_cb(uint32_t changed, const SolderingModel_t * model, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    bool error = model->State == SOLDERING_STATE_TIP_REMOVED || model->State == SOLDERING_STATE_NOT_CONNECTED;
+
+    /*Only the fields the widgets depend on have to be checked, the setters skip unchanged values too*/
+    if(changed & (SOLDERING_MODEL_SETPOINT | SOLDERING_MODEL_ACTIVE_SETPOINT | SOLDERING_MODEL_STATE |
+                  SOLDERING_MODEL_SETPOINT_EDITED | SOLDERING_MODEL_BLINK)) {
+        /*In the holder the sleep temperature alternates with the setpoint unless it has just been changed*/
+        if(model->State == SOLDERING_STATE_SLEEP && !model->SetPointEdited && !model->Blink) {
+            text_set(screen.caption, &screen.caption_text, "Sleep\nTemperature");
+            digits_set(&screen.setpoint, model->ActiveSetPoint, false);
+        }
+        else {
+            text_set(screen.caption, &screen.caption_text, "Soldering\nTemperature");
+            digits_set(&screen.setpoint, model->SetPoint, false);
+        }
+    }
+
+    if(changed & (SOLDERING_MODEL_TIP_TEMPERATURE | SOLDERING_MODEL_STATE | SOLDERING_MODEL_BLINK)) {
+        if(error) digits_set(&screen.tip, 0, !model->Blink);
+        else digits_set(&screen.tip, model->TipTemperature, false);
+    }
+
+    if(changed & (SOLDERING_MODEL_HEATING_POWER | SOLDERING_MODEL_STATE)) {
+        lv_bar_set_value(screen.power, error ? 0 : model->HeatingPower, LV_ANIM_OFF);
+    }
+
+    if(changed & (SOLDERING_MODEL_STATE | SOLDERING_MODEL_BLINK)) {
+        const char * text;
+        switch(model->State) {
+            case SOLDERING_STATE_SLEEP:
+                text = "Sleep";
+                break;
+            case SOLDERING_STATE_TIP_REMOVED:
+                text = model->Blink ? "Soldering tip is removed!" : "";
+                break;
+            case SOLDERING_STATE_NOT_CONNECTED:
+                text = model->Blink ? "Soldering iron is not connected!" : "";
+                break;
+            default:
+                text = "Heating";
+                break;
+        }
+        if(error != screen.banner_error) {
+            screen.banner_error = error;
+            lv_obj_set_style_text_color(screen.banner, error ? COLOR_ERROR : COLOR_TEXT, 0);
+        }
+        text_set(screen.banner, &screen.banner_text, text);
+    }
+
+    if(changed & SOLDERING_MODEL_IN_HOLDER) {
+        indicator_set(screen.holder, &screen.holder_on, model->InHolder);
+    }
+
+    if(changed & SOLDERING_MODEL_STATE) {
+        indicator_set(screen.sleep, &screen.sleep_on, model->State == SOLDERING_STATE_SLEEP);
+    }
+}
+
+static void root_delete_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    SolderingModel_RemoveObserver(model_changed_cb, NULL);
+    memset(&screen, 0, sizeof(screen));
+}
+
+static void stats_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    SolderingScreen_Widget_t widget = (SolderingScreen_Widget_t)(uintptr_t)lv_event_get_user_data(e);
+
+    if(code == LV_EVENT_DRAW_MAIN_BEGIN) {
+        lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+        stats[widget].draws++;
+        stats[widget].area += lv_area_get_size(draw_ctx->clip_area);
+        draw_start = Perf_Now();
+    }
+    else if(code == LV_EVENT_DRAW_POST_END) {
+        stats[widget].time_us += Perf_ToUs(Perf_Now() - draw_start);
+    }
+}
+
+/**
+ * The label reserves font_h / 4 around itself for italic letters. With LV_LABEL_LONG_CLIP
+ * the text is clipped to the label anyway, so don't invalidate the neighbours.
+ * Called after the class handler.
+ */
+static void label_ext_draw_cb(lv_event_t * e)
+{
+    lv_coord_t * size = lv_event_get_param(e);
+    *size = 0;
+}
+
+/**
+ * Create a label with fixed size and centered text.
+ * With `widget` < _SOLDERING_SCREEN_WIDGET_NUM its draws are measured.
+ */
+static lv_obj_t * text_create(lv_obj_t * parent, const lv_font_t * font, lv_coord_t x, lv_coord_t y, lv_coord_t w,
+                              lv_coord_t h, SolderingScreen_Widget_t widget)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_obj_set_pos(label, x, y);
+    lv_obj_set_size(label, w, h);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_color(label, COLOR_TEXT, 0);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_label_set_long_mode(label, LV_LABEL_LONG_CLIP);
+    lv_label_set_text_static(label, "");
+    lv_obj_add_event_cb(label, label_ext_draw_cb, LV_EVENT_REFR_EXT_DRAW_SIZE, NULL);
+    lv_obj_refresh_ext_draw_size(label);
+    if(widget < _SOLDERING_SCREEN_WIDGET_NUM) {
+        lv_obj_add_event_cb(label, stats_event_cb, LV_EVENT_ALL, (void *)(uintptr_t)widget);
+    }
+    return label;
+}
+
+static void digits_create(digits_t * digits, lv_obj_t * parent, lv_coord_t y, DigitSprite_Color_t color,
+                          SolderingScreen_Widget_t widget)
+{
+    uint32_t i;
+
+    /*Image descriptors of the sprites, the pixels stay in flash*/
+    for(i = 0; i < 10; i++) {
+        lv_img_dsc_t * dsc = &sprites[color][i];
+        dsc->header.cf = LV_IMG_CF_TRUE_COLOR;
+        dsc->header.always_zero = 0;
+        dsc->header.w = DIGIT_SPRITE_W;
+        dsc->header.h = DIGIT_SPRITE_H;
+        dsc->data_size = sizeof(DigitSprites[color][i]);
+        dsc->data = (const uint8_t *)DigitSprites[color][i];
+
+        /*Open every sprite now, even those not shown yet: changing a digit hits the image cache*/
+        lv_port_cache_prewarm_img(dsc);
+    }
+
+    digits->color = color;
+    for(i = 0; i < SOLDERING_SCREEN_DIGITS; i++) {
+        lv_obj_t * img = lv_img_create(parent);
+        lv_obj_set_pos(img, DIGIT_X + i * DIGIT_PITCH, y + (ROW_H - DIGIT_SPRITE_H) / 2);
+        lv_obj_set_size(img, DIGIT_SPRITE_W, DIGIT_SPRITE_H);
+        lv_obj_add_flag(img, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(img, stats_event_cb, LV_EVENT_ALL, (void *)(uintptr_t)widget);
+        digits->cell[i] = img;
+        digits->shown[i] = 0;
+    }
+}
+
+/**
+ * Show a right aligned number without leading zeros. Only the cells whose digit
+ * changes are invalidated, an empty cell is hidden and the background shows through.
+ */
+static void digits_set(digits_t * digits, uint32_t value, bool blank)
+{
+    int32_t i;
+
+    for(i = SOLDERING_SCREEN_DIGITS - 1; i >= 0; i--) {
+        char c = 0;
+        if(!blank && (value != 0 || i == SOLDERING_SCREEN_DIGITS - 1)) {
+            c = (char)('0' + value % 10);
+            value /= 10;
+        }
+
+        if(c == digits->shown[i]) continue;
+        if(c == 0) {
+            lv_obj_add_flag(digits->cell[i], LV_OBJ_FLAG_HIDDEN);
+        }
+        else {
+            lv_img_set_src(digits->cell[i], &sprites[digits->color][c - '0']);
+            if(digits->shown[i] == 0) lv_obj_clear_flag(digits->cell[i], LV_OBJ_FLAG_HIDDEN);
+        }
+        digits->shown[i] = c;
+    }
+}
+
+static void unit_create(lv_obj_t * parent, lv_coord_t y)
+{
+    lv_coord_t text_h = lv_font_get_line_height(FONT_TEXT);
+    lv_coord_t text_y = y + (ROW_H - text_h) / 2;
+
+    lv_obj_t * label = text_create(parent, FONT_TEXT, UNIT_X, text_y, 30, text_h, _SOLDERING_SCREEN_WIDGET_NUM);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_LEFT, 0);
+    lv_label_set_text_static(label, "°C");
+}
+
+static void text_set(lv_obj_t * label, const char ** shown, const char * text)
+{
+    if(*shown == text) return;
+    *shown = text;
+    lv_label_set_text_static(label, text);
+}
+
+static void indicator_set(lv_obj_t * label, bool * shown, bool on)
+{
+    if(*shown == on) return;
+    *shown = on;
+    lv_obj_set_style_text_color(label, on ? COLOR_INDICATOR_ON : COLOR_INDICATOR_OFF, 0);
+}
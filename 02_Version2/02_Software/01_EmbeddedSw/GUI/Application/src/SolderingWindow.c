@@ -0,0 +1,370 @@
+/**
+ * @file SolderingWindow.c
+ *
+ * Every dynamic widget has a cache of what it shows. The texts are constant strings
+ * (compared by address) and the readouts keep the character of each digit cell, so a GUI
+ * tick without changes costs no formatting, no setter call and no repaint.
+ *
+ * Blinking (errors, sleep temperature in the holder) is driven by a WM timer of the
+ * dialog: the error texts are hidden/shown instead of being set to " " and back.
+ *
+ * The setpoint and the tip temperature are drawn from the pre-rendered RGB565 digit
+ * sprites (DigitSprites.c) with GUI_DrawBitmap(), which copies them to the LCD without
+ * any conversion. Only the rectangle of a changed digit is invalidated.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "SolderingWindow.h"
+#include "SolderingModel.h"
+#include "Perf.h"
+#include "DigitSprites.h"
+#include "DIALOG.h"
+#include <string.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define ID_TIMER_BLINK      0
+
+#define DIGITS              3       /*cells of a readout*/
+#define DIGIT_PITCH         36
+#define DIGIT_BOX_W         140     /*size of hText_2/hText_4*/
+#define DIGIT_BOX_H         70
+#define DIGIT_X0            ((DIGIT_BOX_W - (DIGITS - 1) * DIGIT_PITCH - DIGIT_SPRITE_W) / 2)
+#define DIGIT_Y0            ((DIGIT_BOX_H - DIGIT_SPRITE_H) / 2)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    WM_HWIN hItem;
+    const char * text;      /*shown txt_... string, NULL: unknown*/
+    bool visible;
+} text_cache_t;
+
+typedef struct {
+    WM_HWIN hItem;
+    int32_t value;          /*-1: unknown*/
+} progbar_cache_t;
+
+typedef struct {
+    WM_HWIN hItem;
+    DigitSprite_Color_t color;
+    char shown[DIGITS];     /*character in the cells, 0: empty*/
+} digits_cache_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void update(void);
+static void model_changed_cb(uint32_t changed, const SolderingModel_t * model, void * user_data);
+static void _cbWindow(WM_MESSAGE * pMsg);
+static void _cbText(WM_MESSAGE * pMsg);
+static void _cbProgbar(WM_MESSAGE * pMsg);
+static void _cbDigits(WM_MESSAGE * pMsg);
+static void text_cache_init(text_cache_t * c, WM_HWIN hItem);
+static void text_set(text_cache_t * c, const char * text);
+static void visible_set(text_cache_t * c, bool visible);
+static void progbar_set(progbar_cache_t * c, int32_t value);
+static void digits_init(digits_cache_t * c, WM_HWIN hItem, DigitSprite_Color_t color);
+static void digits_set(digits_cache_t * c, uint32_t value, bool blank);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+/*Handles of WindowDLG.c*/
+extern WM_HWIN hDialog;
+extern WM_HWIN hText_0;     /*"Soldering/Sleep Temperature"*/
+extern WM_HWIN hText_1;
+extern WM_HWIN hText_2;     /*setpoint*/
+extern WM_HWIN hText_3;
+extern WM_HWIN hText_4;     /*tip temperature*/
+extern WM_HWIN hText_5;
+extern WM_HWIN hText_6;     /*"Heating Power" or the error*/
+extern WM_HWIN hProgbar_0;  /*heating power*/
+
+/*The texts are compared by address: one instance of each*/
+static const char txt_soldering[] = "Soldering\n Temperature";
+static const char txt_sleep[] = "Sleep\n Temperature";
+static const char txt_heating[] = "Heating Power";
+static const char txt_tip_removed[] = "Soldering tip is removed!";
+static const char txt_not_connected[] = "Soldering iron is not connected!";
+
+/*BMPM565 is the pixel format of the LCD (GUICC_M565): the sprites are copied as they are*/
+#define DIGIT_BITMAP(c, d)  {DIGIT_SPRITE_W, DIGIT_SPRITE_H, DIGIT_SPRITE_W * 2, 16, \
+                             (const U8 *)DigitSprites[c][d], NULL, GUI_DRAW_BMPM565}
+#define DIGIT_BITMAPS(c)    {DIGIT_BITMAP(c, 0), DIGIT_BITMAP(c, 1), DIGIT_BITMAP(c, 2), DIGIT_BITMAP(c, 3), \
+                             DIGIT_BITMAP(c, 4), DIGIT_BITMAP(c, 5), DIGIT_BITMAP(c, 6), DIGIT_BITMAP(c, 7), \
+                             DIGIT_BITMAP(c, 8), DIGIT_BITMAP(c, 9)}
+static const GUI_BITMAP bmDigit[_DIGIT_SPRITE_COLOR_NUM][10] = {
+    DIGIT_BITMAPS(DIGIT_SPRITE_WHITE),
+    DIGIT_BITMAPS(DIGIT_SPRITE_RED),
+};
+
+static text_cache_t caption;
+static digits_cache_t setpoint;
+static digits_cache_t tip;
+static text_cache_t banner;
+static progbar_cache_t power;
+
+static WM_CALLBACK * pfDialog;  /*callback of the dialog before subclassing*/
+static bool blink;              /*phase of the blinking texts*/
+static SolderingWindow_Stats_t stats;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void SolderingWindow_Init(void)
+{
+    WM_HWIN aText[] = {hText_0, hText_1, hText_3, hText_5, hText_6};
+    uint32_t i;
+
+    Perf_Init();
+
+    text_cache_init(&caption, hText_0);
+    digits_init(&setpoint, hText_2, DIGIT_SPRITE_WHITE);
+    digits_init(&tip, hText_4, DIGIT_SPRITE_RED);
+    text_cache_init(&banner, hText_6);
+    power.hItem = hProgbar_0;
+    power.value = -1;
+
+    /*Subclass the dialog and the widgets to count the repaints*/
+    pfDialog = WM_SetCallback(hDialog, _cbWindow);
+    for(i = 0; i < GUI_COUNTOF(aText); i++) {
+        WM_SetCallback(aText[i], _cbText);
+    }
+    WM_SetCallback(hProgbar_0, _cbProgbar);
+
+    WM_CreateTimer(hDialog, ID_TIMER_BLINK, SOLDERING_WINDOW_BLINK_PERIOD, 0);
+
+    update();
+    SolderingModel_AddObserver(model_changed_cb, NULL);
+}
+
+void SolderingWindow_Exec(void)
+{
+    uint32_t t = Perf_Now();
+    GUI_Exec();
+    t = Perf_ToUs(Perf_Now() - t);
+
+    stats.ticks++;
+    stats.tick_time_us += t;
+    if(t > stats.tick_time_max_us) stats.tick_time_max_us = t;
+}
+
+const SolderingWindow_Stats_t * SolderingWindow_GetStats(void)
+{
+    return &stats;
+}
+
+void SolderingWindow_ClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Bring the widgets to the model and the blink phase. Unchanged values are skipped by the setters.
+ */
+static void update(void)
+{
+    const SolderingModel_t * model = SolderingModel_Get();
+
+    if(model->State == SOLDERING_STATE_TIP_REMOVED || model->State == SOLDERING_STATE_NOT_CONNECTED) {
+        progbar_set(&power, 0);
+        digits_set(&tip, 0, !blink);
+        text_set(&banner, model->State == SOLDERING_STATE_TIP_REMOVED ? txt_tip_removed : txt_not_connected);
+        visible_set(&banner, blink);
+        text_set(&caption, txt_soldering);
+        digits_set(&setpoint, model->SetPoint, false);
+        return;
+    }
+
+    visible_set(&banner, true);
+    text_set(&banner, txt_heating);
+    progbar_set(&power, model->HeatingPower);
+    digits_set(&tip, model->TipTemperature, false);
+
+    /*In the holder the sleep temperature alternates with the setpoint unless it has just been changed*/
+    if(model->State == SOLDERING_STATE_SLEEP && !model->SetPointEdited && !blink) {
+        text_set(&caption, txt_sleep);
+        digits_set(&setpoint, model->ActiveSetPoint, false);
+    }
+    else {
+        text_set(&caption, txt_soldering);
+        digits_set(&setpoint, model->SetPoint, false);
+    }
+}
+
+static void model_changed_cb(uint32_t changed, const SolderingModel_t * model, void * user_data)
+{
+    (void)model;
+    (void)user_data;
+
+    /*The blink phase of the model is not used, the WM timer gives it*/
+    if((changed & ~SOLDERING_MODEL_BLINK) == 0) return;
+    update();
+}
+
+static void _cbWindow(WM_MESSAGE * pMsg)
+{
+    uint32_t t;
+
+    switch(pMsg->MsgId) {
+        case WM_TIMER:
+            blink = !blink;
+            update();
+            WM_RestartTimer(pMsg->Data.v, SOLDERING_WINDOW_BLINK_PERIOD);
+            break;
+        case WM_PAINT:
+            t = Perf_Now();
+            pfDialog(pMsg);
+            stats.paints++;
+            stats.paint_time_us += Perf_ToUs(Perf_Now() - t);
+            break;
+        default:
+            pfDialog(pMsg);
+            break;
+    }
+}
+
+static void _cbText(WM_MESSAGE * pMsg)
+{
+    if(pMsg->MsgId == WM_PAINT) {
+        uint32_t t = Perf_Now();
+        TEXT_Callback(pMsg);
+        stats.paints++;
+        stats.paint_time_us += Perf_ToUs(Perf_Now() - t);
+    }
+    else {
+        TEXT_Callback(pMsg);
+    }
+}
+
+static void _cbProgbar(WM_MESSAGE * pMsg)
+{
+    if(pMsg->MsgId == WM_PAINT) {
+        uint32_t t = Perf_Now();
+        PROGBAR_Callback(pMsg);
+        stats.paints++;
+        stats.paint_time_us += Perf_ToUs(Perf_Now() - t);
+    }
+    else {
+        PROGBAR_Callback(pMsg);
+    }
+}
+
+/**
+ * Paint the digits of hText_2/hText_4 instead of the TEXT widget.
+ * The whole box is opaque: the empty cells and the margins are cleared to black.
+ */
+static void _cbDigits(WM_MESSAGE * pMsg)
+{
+    const digits_cache_t * c;
+    uint32_t t;
+    uint32_t i;
+
+    if(pMsg->MsgId != WM_PAINT) {
+        TEXT_Callback(pMsg);
+        return;
+    }
+
+    t = Perf_Now();
+    c = pMsg->hWin == setpoint.hItem ? &setpoint : &tip;
+    GUI_SetBkColor(GUI_BLACK);
+    GUI_Clear();
+    for(i = 0; i < DIGITS; i++) {
+        if(c->shown[i] == 0) continue;
+        GUI_DrawBitmap(&bmDigit[c->color][c->shown[i] - '0'], DIGIT_X0 + i * DIGIT_PITCH, DIGIT_Y0);
+    }
+    stats.paints++;
+    stats.paint_time_us += Perf_ToUs(Perf_Now() - t);
+}
+
+static void text_cache_init(text_cache_t * c, WM_HWIN hItem)
+{
+    c->hItem = hItem;
+    c->text = NULL;
+    c->visible = true;
+}
+
+/**
+ * Show one of the txt_... strings
+ */
+static void text_set(text_cache_t * c, const char * text)
+{
+    if(c->text == text) return;
+
+    TEXT_SetText(c->hItem, text);
+    c->text = text;
+    stats.set_calls++;
+}
+
+static void visible_set(text_cache_t * c, bool visible)
+{
+    if(c->visible == visible) return;
+
+    if(visible) WM_ShowWindow(c->hItem);
+    else WM_HideWindow(c->hItem);
+    c->visible = visible;
+    stats.set_calls++;
+}
+
+static void progbar_set(progbar_cache_t * c, int32_t value)
+{
+    if(c->value == value) return;
+
+    PROGBAR_SetValue(c->hItem, value);
+    c->value = value;
+    stats.set_calls++;
+}
+
+static void digits_init(digits_cache_t * c, WM_HWIN hItem, DigitSprite_Color_t color)
+{
+    c->hItem = hItem;
+    c->color = color;
+    memset(c->shown, 0, sizeof(c->shown));
+
+    TEXT_SetText(hItem, "");
+    WM_SetCallback(hItem, _cbDigits);
+    WM_ClrHasTrans(hItem);      /*the dialog doesn't have to be painted below it*/
+}
+
+/**
+ * Show a right aligned number without leading zeros, or nothing if `blank`.
+ * Only the rectangles of the changed digits are invalidated.
+ */
+static void digits_set(digits_cache_t * c, uint32_t value, bool blank)
+{
+    GUI_RECT r;
+    int32_t i;
+
+    for(i = DIGITS - 1; i >= 0; i--) {
+        char ch = 0;
+        if(!blank && (value != 0 || i == DIGITS - 1)) {
+            ch = (char)('0' + value % 10);
+            value /= 10;
+        }
+
+        if(ch == c->shown[i]) continue;
+        c->shown[i] = ch;
+        r.x0 = DIGIT_X0 + i * DIGIT_PITCH;
+        r.y0 = DIGIT_Y0;
+        r.x1 = r.x0 + DIGIT_SPRITE_W - 1;
+        r.y1 = r.y0 + DIGIT_SPRITE_H - 1;
+        WM_InvalidateRect(c->hItem, &r);
+        stats.set_calls++;
+    }
+}
@@ -0,0 +1,315 @@
+/**
+ * @file TrendScreen.c
+ *
+ *   Tip temperature                    30 s
+ *   500 +-------------------------------+
+ *       |      ____     |  ____         |
+ *       |     /    \___ | /             |
+ *     0 +-------------------------------+
+ *                       ^ sweep position
+ *
+ * One series with two points per column: the maximum and the minimum of the column.
+ * As there are more points than pixels the chart draws a vertical line from the
+ * minimum to the maximum of every column (crowded mode), which is the min/max envelope.
+ * The chart is in circular mode: a new column overwrites the oldest one at the sweep
+ * position and only the strip around it is invalidated, the rest of the plot stays.
+ * The two points after the newest column are left empty to show the sweep position.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "TrendScreen.h"
+#include "Perf.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define SCREEN_HOR_RES      320
+#define SCREEN_VER_RES      240
+
+#define CHART_X             40
+#define CHART_Y             32
+#define CHART_W             TREND_SCREEN_COLUMNS
+#define CHART_H             200
+#define CHART_POINTS        (2 * CHART_W)
+#define CHART_T_MAX         500     /*[°C] top of the plot*/
+#define CHART_T_DIV         100     /*[°C] between the division lines*/
+
+#define SCALE_W             34
+
+#define COLOR_TEXT          lv_color_white()
+#define COLOR_SCALE         lv_color_hex(0x808080)
+#define COLOR_PLOT_BG       lv_color_hex(0x101010)
+#define COLOR_DIV_LINE      lv_color_hex(0x303030)
+#define COLOR_TREND         lv_color_hex(0xFF0000)
+
+#define FONT_TEXT           (&lv_font_montserrat_20)
+#define FONT_SCALE          (&lv_font_montserrat_14)
+
+#define REFRESH_PERIOD      (TEMP_TREND_PERIOD_MS / 2)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_obj_t * root;
+    lv_obj_t * chart;
+    lv_obj_t * window_label;
+    lv_chart_series_t * ser;
+    lv_timer_t * timer;
+    TrendScreen_Window_t window;
+    uint32_t next_column;       /*index of the next column in the whole history*/
+    uint32_t pos;               /*sweep position: the first point of the next column*/
+} screen_t;
+
+typedef struct {
+    uint32_t decimation;        /*measurements per column*/
+    const char * text;
+} window_dsc_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void refill(void);
+static void column_set(uint32_t pos, uint32_t column);
+static void timer_cb(lv_timer_t * t);
+static void root_delete_cb(lv_event_t * e);
+static void key_event_cb(lv_event_t * e);
+static void stats_event_cb(lv_event_t * e);
+static lv_obj_t * scale_label_create(lv_obj_t * parent, lv_coord_t y, const char * text);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static screen_t screen;
+static TrendScreen_Stats_t stats;
+static uint32_t draw_start;
+
+/*TREND_SCREEN_COLUMNS * decimation * TEMP_TREND_PERIOD_MS*/
+static const window_dsc_t windows[_TREND_SCREEN_WINDOW_NUM] = {
+    [TREND_SCREEN_WINDOW_SHORT] = {1, "30 s"},
+    [TREND_SCREEN_WINDOW_LONG] = {TEMP_TREND_BUCKET, "8 min"},
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * TrendScreen_Create(lv_obj_t * parent)
+{
+    static const char * const scale_text[] = {"500", "400", "300", "200", "100", "0"};
+    uint32_t i;
+
+    Perf_Init();
+    memset(&screen, 0, sizeof(screen));
+
+    lv_obj_t * root = lv_obj_create(parent);
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, SCREEN_HOR_RES, SCREEN_VER_RES);
+    lv_obj_set_style_bg_color(root, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(root, LV_OPA_COVER, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(root, root_delete_cb, LV_EVENT_DELETE, NULL);
+    lv_obj_add_event_cb(root, key_event_cb, LV_EVENT_KEY, NULL);
+    screen.root = root;
+
+    lv_obj_t * title = lv_label_create(root);
+    lv_obj_set_pos(title, 10, 4);
+    lv_obj_set_style_text_font(title, FONT_TEXT, 0);
+    lv_obj_set_style_text_color(title, COLOR_TEXT, 0);
+    lv_label_set_text_static(title, "Tip temperature");
+
+    screen.window_label = lv_label_create(root);
+    lv_obj_set_pos(screen.window_label, SCREEN_HOR_RES - 90, 4);
+    lv_obj_set_size(screen.window_label, 80, lv_font_get_line_height(FONT_TEXT));
+    lv_obj_set_style_text_font(screen.window_label, FONT_TEXT, 0);
+    lv_obj_set_style_text_color(screen.window_label, COLOR_TEXT, 0);
+    lv_obj_set_style_text_align(screen.window_label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_label_set_long_mode(screen.window_label, LV_LABEL_LONG_CLIP);
+
+    for(i = 0; i < sizeof(scale_text) / sizeof(scale_text[0]); i++) {
+        scale_label_create(root, CHART_Y + (CHART_H - 1) * i / (sizeof(scale_text) / sizeof(scale_text[0]) - 1),
+                           scale_text[i]);
+    }
+
+    /*Plain chart: no padding, border and points, 1 px lines*/
+    lv_obj_t * chart = lv_chart_create(root);
+    lv_obj_remove_style_all(chart);
+    lv_obj_set_pos(chart, CHART_X, CHART_Y);
+    lv_obj_set_size(chart, CHART_W, CHART_H);
+    lv_obj_set_style_bg_color(chart, COLOR_PLOT_BG, LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(chart, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_line_color(chart, COLOR_DIV_LINE, LV_PART_MAIN);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_MAIN);
+    lv_obj_set_style_line_width(chart, 1, LV_PART_ITEMS);
+    lv_obj_set_style_size(chart, 0, LV_PART_INDICATOR);
+    lv_obj_clear_flag(chart, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_chart_set_type(chart, LV_CHART_TYPE_LINE);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_CIRCULAR);
+    lv_chart_set_div_line_count(chart, CHART_T_MAX / CHART_T_DIV + 1, 0);
+    lv_chart_set_range(chart, LV_CHART_AXIS_PRIMARY_Y, 0, CHART_T_MAX);
+    lv_chart_set_point_count(chart, CHART_POINTS);
+    screen.ser = lv_chart_add_series(chart, COLOR_TREND, LV_CHART_AXIS_PRIMARY_Y);
+    lv_obj_add_event_cb(chart, stats_event_cb, LV_EVENT_ALL, NULL);
+    screen.chart = chart;
+
+    TrendScreen_SetWindow(TREND_SCREEN_WINDOW_SHORT);
+    refill();   /*SetWindow() skips it if the window is the same*/
+
+    screen.timer = lv_timer_create(timer_cb, REFRESH_PERIOD, NULL);
+
+    return root;
+}
+
+void TrendScreen_SetWindow(TrendScreen_Window_t window)
+{
+    if(screen.root == NULL || window >= _TREND_SCREEN_WINDOW_NUM) return;
+
+    lv_label_set_text_static(screen.window_label, windows[window].text);
+    if(screen.window == window) return;
+
+    screen.window = window;
+    refill();
+}
+
+TrendScreen_Window_t TrendScreen_GetWindow(void)
+{
+    return screen.window;
+}
+
+void TrendScreen_Refresh(void)
+{
+    uint32_t decimation = windows[screen.window].decimation;
+    uint32_t columns = TempTrend_GetCount() / decimation;
+
+    if(screen.root == NULL || columns == screen.next_column) return;
+
+    /*Too much to add one by one: redraw the whole plot*/
+    if(columns - screen.next_column >= TREND_SCREEN_COLUMNS) {
+        refill();
+        return;
+    }
+
+    while(screen.next_column < columns) {
+        column_set(screen.pos, screen.next_column);
+        screen.pos = (screen.pos + 2) % CHART_POINTS;
+        lv_chart_set_value_by_id(screen.chart, screen.ser, screen.pos, LV_CHART_POINT_NONE);
+        lv_chart_set_value_by_id(screen.chart, screen.ser, screen.pos + 1, LV_CHART_POINT_NONE);
+        screen.next_column++;
+    }
+}
+
+const TrendScreen_Stats_t * TrendScreen_GetStats(void)
+{
+    return &stats;
+}
+
+void TrendScreen_ClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Fill the whole plot from the history of the selected window, the newest column on the right.
+ * In circular mode the points are drawn in index order, the sweep position starts from the left.
+ */
+static void refill(void)
+{
+    uint32_t columns = TempTrend_GetCount() / windows[screen.window].decimation;
+    uint32_t first = columns > TREND_SCREEN_COLUMNS - 1 ? columns - (TREND_SCREEN_COLUMNS - 1) : 0;
+    uint32_t pos = (TREND_SCREEN_COLUMNS - (columns - first)) * 2;
+    uint32_t i;
+
+    lv_chart_set_all_value(screen.chart, screen.ser, LV_CHART_POINT_NONE);
+    for(i = first; i < columns; i++) {
+        column_set(pos, i);
+        pos = (pos + 2) % CHART_POINTS;
+    }
+    screen.pos = pos;
+    screen.next_column = columns;
+}
+
+/**
+ * Write a column of the history to the points at `pos` and `pos + 1` and invalidate them
+ */
+static void column_set(uint32_t pos, uint32_t column)
+{
+    uint32_t decimation = windows[screen.window].decimation;
+    TempTrend_MinMax_t mm;
+    lv_coord_t max = LV_CHART_POINT_NONE;
+    lv_coord_t min = LV_CHART_POINT_NONE;
+
+    if(TempTrend_Get(column * decimation, decimation, &mm)) {
+        max = LV_MIN(mm.max, CHART_T_MAX);
+        min = LV_MIN(mm.min, CHART_T_MAX);
+    }
+    lv_chart_set_value_by_id(screen.chart, screen.ser, pos, max);
+    lv_chart_set_value_by_id(screen.chart, screen.ser, pos + 1, min);
+    stats.columns++;
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+    TrendScreen_Refresh();
+}
+
+static void root_delete_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    lv_timer_del(screen.timer);
+    memset(&screen, 0, sizeof(screen));
+}
+
+/**
+ * The encoder in edit mode: clockwise to the long window, counterclockwise to the short one
+ */
+static void key_event_cb(lv_event_t * e)
+{
+    uint32_t key = lv_event_get_key(e);
+
+    if(key == LV_KEY_RIGHT) TrendScreen_SetWindow(TREND_SCREEN_WINDOW_LONG);
+    else if(key == LV_KEY_LEFT) TrendScreen_SetWindow(TREND_SCREEN_WINDOW_SHORT);
+}
+
+static void stats_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if(code == LV_EVENT_DRAW_MAIN_BEGIN) {
+        lv_draw_ctx_t * draw_ctx = lv_event_get_draw_ctx(e);
+        stats.draws++;
+        stats.area += lv_area_get_size(draw_ctx->clip_area);
+        draw_start = Perf_Now();
+    }
+    else if(code == LV_EVENT_DRAW_POST_END) {
+        stats.time_us += Perf_ToUs(Perf_Now() - draw_start);
+    }
+}
+
+/**
+ * Right aligned temperature on the left of the plot, vertically centered on `y`
+ */
+static lv_obj_t * scale_label_create(lv_obj_t * parent, lv_coord_t y, const char * text)
+{
+    lv_coord_t h = lv_font_get_line_height(FONT_SCALE);
+    lv_obj_t * label = lv_label_create(parent);
+    lv_obj_set_pos(label, CHART_X - SCALE_W - 4, y - h / 2);
+    lv_obj_set_size(label, SCALE_W, h);
+    lv_obj_set_style_text_font(label, FONT_SCALE, 0);
+    lv_obj_set_style_text_color(label, COLOR_SCALE, 0);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_label_set_text_static(label, text);
+    return label;
+}
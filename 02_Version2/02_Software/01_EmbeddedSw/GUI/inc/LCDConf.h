@@ -58,34 +58,7 @@ Purpose     : Display driver configuration file
 #include "LCD_Private.h"
 #include "GUI_Private.h"
 #include "LCD_ConfDefaults.h"
-//
-#define	LCD_DATA_PORT				GPIOB
-#define	LCD_CONTROL_PORT			GPIOB
-//Chip select
-#define	LCD_CS_PORT					GPIOB
-#define LCD_CS_PIN					GPIO_PIN_8
-#define LCD_CS_H					0x00000100
-#define LCD_CS_L					0x01000000
-//Register Select
-#define	LCD_RS_PORT					GPIOB
-#define LCD_RS_PIN					GPIO_PIN_9
-#define LCD_RS_H					0x00000200
-#define LCD_RS_L					0x02000000
-//ReaD
-#define	LCD_RD_PORT					GPIOB
-#define LCD_RD_PIN					GPIO_PIN_10
-#define LCD_RD_H					0x00000400
-#define LCD_RD_L					0x04000000
-//WRite
-#define	LCD_WR_PORT					GPIOB
-#define LCD_WR_PIN					GPIO_PIN_12
-#define LCD_WR_H					0x00001000
-#define LCD_WR_L					0x10000000
-//ReSeT
-#define	LCD_RST_PORT				GPIOC
-#define LCD_RST_PIN					GPIO_PIN_10
-#define LCD_RST_H					0x00000400
-#define LCD_RST_L					0x04000000
+#include "LcdPanel.h"
 //
 void LcdWriteReg(U8 Data);
 U8 LcdReadData(void);
@@ -94,6 +67,7 @@ void LcdWriteDataMultiple(U8 * pData, int NumItems);
 void LcdReadDataMultiple(U8 * pData, int NumItems);
 void GPIO_Init(void);
 void LcdInit(void);
+void LcdConf_SetRotation(LcdPanel_Rotation_t Rot);
 //void LcdClear(char mode,char color_r,char color_g, char color_b);
 void LcdClear(U16 color);
 void ReadReg(U8 Reg, U8 * pData, U8 NumItems);
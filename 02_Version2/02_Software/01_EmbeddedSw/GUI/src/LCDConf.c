@@ -54,7 +54,8 @@ Purpose     : Display controller configuration (single layer)
 #include "LCDConf.h"
 #include "GUI.h"
 #include "GUIDRV_FlexColor.h"
-#include "stm32f4xx.h"
+#include "WM.h"
+#include "LcdPanel.h"
 /*********************************************************************
 *
 *       Layer configuration (to be modified)
@@ -65,8 +66,28 @@ Purpose     : Display controller configuration (single layer)
 //
 // Physical display size
 //
-#define XSIZE_PHYS  240 // To be adapted to x-screen size
-#define YSIZE_PHYS  320 // To be adapted to y-screen size
+#define XSIZE_PHYS  LCD_PANEL_WIDTH  // To be adapted to x-screen size
+#define YSIZE_PHYS  LCD_PANEL_HEIGHT // To be adapted to y-screen size
+
+/*********************************************************************
+*
+*       Static data
+*
+**********************************************************************
+*/
+//
+// Orientation of the LcdPanel rotations. FlexColor does it with the
+// address counters of the controller (like LVGL), not pixel by pixel.
+// The module shows GRAM mirrored, so upright portrait needs GUI_MIRROR_X.
+//
+static const int _aOrientation[] = {
+  GUI_MIRROR_X,                               // LCD_PANEL_ROT_0
+  GUI_SWAP_XY | GUI_MIRROR_X | GUI_MIRROR_Y,  // LCD_PANEL_ROT_90
+  GUI_MIRROR_Y,                               // LCD_PANEL_ROT_180
+  GUI_SWAP_XY,                                // LCD_PANEL_ROT_270
+};
+
+static GUI_DEVICE * _pDevice;
 
 /*********************************************************************
 *
@@ -106,12 +127,7 @@ Purpose     : Display controller configuration (single layer)
 *   Sets display register
 */
 void LcdWriteReg(U8 Data) {
-	LCD_CONTROL_PORT->BSRR=LCD_RS_L|LCD_CS_L|LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_CS_PIN|LCD_RS_PIN,GPIO_PIN_RESET);//LCD_CONTROL_PORT->BSRR=LCD_RS_L|LCD_CS_L;//RS:Low
-	LCD_DATA_PORT->ODR&=0xFFFFFF00;
-	LCD_DATA_PORT->ODR|=Data;
-	//LCD_CONTROL_PORT->BSRR=LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN,GPIO_PIN_RESET);//LCD_CONTROL_PORT->BSRR=LCD_WR_L; //WR:Low
-	//asm("nop");
-	LCD_CONTROL_PORT->BSRR=LCD_WR_H|LCD_CS_H;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN|LCD_CS_PIN,GPIO_PIN_SET);
+  LcdBus_WriteReg(Data);
 }
 
 /********************************************************************
@@ -134,14 +150,7 @@ U8 LcdReadReg(void) {
 *   Writes a value to a display register
 */
 void LcdWriteData(U8 Data) {
-	//LCD_CONTROL_PORT->BSRR=LCD_RS_H|LCD_CS_L;//RS:High
-	LCD_CONTROL_PORT->BSRR=LCD_RS_H|LCD_CS_L|LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_CS_PIN,GPIO_PIN_RESET);
-	//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_RS_PIN,GPIO_PIN_SET);
-	LCD_DATA_PORT->ODR&=0xFFFFFF00;
-	LCD_DATA_PORT->ODR|=Data;
-	//LCD_CONTROL_PORT->BSRR=LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN,GPIO_PIN_RESET);//LCD_CONTROL_PORT->BSRR=LCD_WR_L; //WR:Low
-	//asm("nop");
-	LCD_CONTROL_PORT->BSRR=LCD_WR_H|LCD_CS_PIN;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN|LCD_CS_PIN,GPIO_PIN_SET);//LCD_CONTROL_PORT->BSRR=LCD_WR_H|LCD_CS_H;//WR:High, CS:High
+  LcdBus_WriteData(Data);
 }
 
 /********************************************************************
@@ -152,16 +161,7 @@ void LcdWriteData(U8 Data) {
 *   Writes multiple values to a display register.
 */
 void LcdWriteDataMultiple(U8 * pData, int NumItems) {
-	//LCD_CONTROL_PORT->BSRR=LCD_RS_H|LCD_CS_L;//RS:High
-	while (NumItems--) {
-		LCD_CONTROL_PORT->BSRR=LCD_RS_H|LCD_CS_L|LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_CS_PIN,GPIO_PIN_RESET);
-		//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_RS_PIN,GPIO_PIN_SET);
-		LCD_DATA_PORT->ODR&=0xFFFFFF00;
-		LCD_DATA_PORT->ODR|=*pData++;
-		//LCD_CONTROL_PORT->BSRR=LCD_WR_L;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN,GPIO_PIN_RESET);//LCD_CONTROL_PORT->BSRR=LCD_WR_L; //WR:Low
-		//asm("nop");
-		LCD_CONTROL_PORT->BSRR=LCD_WR_H|LCD_CS_PIN;//HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN|LCD_CS_PIN,GPIO_PIN_SET);//LCD_CONTROL_PORT->BSRR=LCD_WR_H|LCD_CS_H;//WR:High
-  }
+  LcdBus_WriteDataMultiple(pData, NumItems);
 }
 
 /********************************************************************
@@ -177,143 +177,38 @@ void LcdReadDataMultiple(U8 * pData, int NumItems) {
   }
 }
 
+/********************************************************************
+*
+*       LcdInit
+*
+* Function description:
+*   Initializes the ILI9341 with the panel sequence shared with LVGL.
+*/
 void LcdInit(void) {
-	HAL_GPIO_WritePin(LCD_RST_PORT,LCD_RST_PIN	,GPIO_PIN_RESET);//LCD_RST_PORT->BSRR=LCD_RST_L;//RST:Low
-	//LCD_CONTROL_PORT->BSRR=LCD_CS_H|LCD_RD_H|LCD_WR_H|LCD_RS_H;//WR:High, CS:High, RD: High, RST: Low
-	HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_WR_PIN|LCD_CS_PIN|LCD_RD_PIN|LCD_RS_PIN,GPIO_PIN_SET);
-	HAL_Delay(2);//Reset delay
-	HAL_GPIO_WritePin(LCD_RST_PORT,LCD_RST_PIN	,GPIO_PIN_SET);//LCD_RST_PORT->BSRR=LCD_RST_H;//RST:High
-	//LCD_CONTROL_PORT->BSRR=LCD_CS_L;// CS:Low
-	for(uint8_t i=0; i<3; i++)  {
-		LcdWriteReg(0x00);
-	} // Three extra 0x00s
-	HAL_GPIO_WritePin(LCD_CONTROL_PORT,LCD_CS_PIN,GPIO_PIN_SET);//LCD_CONTROL_PORT->BSRR=0x00000800;//CS:High
-
-	//ILI9341 initialization sequence
-
-	LcdWriteReg(0x01);//soft reset
-	HAL_Delay(10);
-	//power control A
-	LcdWriteReg(0xCB);
-	LcdWriteData(0x39);
-	LcdWriteData(0x2C);
-	LcdWriteData(0x00);
-	LcdWriteData(0x34);
-	LcdWriteData(0x02);
-
-	//power control B
-	LcdWriteReg(0xCF);
-	LcdWriteData(0x00);
-	LcdWriteData(0xC1);
-	LcdWriteData(0x30);
-
-	//driver timing control A
-	LcdWriteReg(0xE8);
-	LcdWriteData(0x85);
-	LcdWriteData(0x00);
-	LcdWriteData(0x78);
-
-	//driver timing control B
-	LcdWriteReg(0xEA);
-	LcdWriteData(0x00);
-	LcdWriteData(0x00);
-
-	//power on sequence control
-	LcdWriteReg(0xED);
-	LcdWriteData(0x64);
-	LcdWriteData(0x03);
-	LcdWriteData(0x12);
-	LcdWriteData(0x81);
-
-	//pump ratio control
-	LcdWriteReg(0xF7);
-	LcdWriteData(0x20);
-
-	//power control,VRH[5:0]
-	LcdWriteReg(0xC0);
-	LcdWriteData(0x23);
-
-	//Power control,SAP[2:0];BT[3:0]
-	LcdWriteReg(0xC1);
-	LcdWriteData(0x10);
-
-	//vcm control
-	LcdWriteReg(0xC5);
-	LcdWriteData(0x3E);
-	LcdWriteData(0x28);
-
-	//vcm control 2
-	LcdWriteReg(0xC7);
-	LcdWriteData(0x86);
-
-	//memory access control
-	LcdWriteReg(0x36);
-	LcdWriteData(0x48);
-
-	//pixel format
-	LcdWriteReg(0x3A);
-	LcdWriteData(0x55);
-
-	//frameration control,normal mode full colours
-	LcdWriteReg(0xB1);
-	LcdWriteData(0x00);
-	LcdWriteData(0x18);
-
-	//display function control
-	LcdWriteReg(0xB6);
-	LcdWriteData(0x08);
-	LcdWriteData(0x82);
-	LcdWriteData(0x27);
-
-	//3gamma function disable
-	LcdWriteReg(0xF2);
-	LcdWriteData(0x00);
-
-	//gamma curve selected
-	LcdWriteReg(0x26);
-	LcdWriteData(0x01);
-
-	//set positive gamma correction
-	LcdWriteReg(0xE0);
-	LcdWriteData(0x0F);
-	LcdWriteData(0x31);
-	LcdWriteData(0x2B);
-	LcdWriteData(0x0C);
-	LcdWriteData(0x0E);
-	LcdWriteData(0x08);
-	LcdWriteData(0x4E);
-	LcdWriteData(0xF1);
-	LcdWriteData(0x37);
-	LcdWriteData(0x07);
-	LcdWriteData(0x10);
-	LcdWriteData(0x03);
-	LcdWriteData(0x0E);
-	LcdWriteData(0x09);
-	LcdWriteData(0x00);
+  LcdPanel_Init();
+}
 
-	//set negative gamma correction
-	LcdWriteReg(0xE1);
-	LcdWriteData(0x00);
-	LcdWriteData(0x0E);
-	LcdWriteData(0x14);
-	LcdWriteData(0x03);
-	LcdWriteData(0x11);
-	LcdWriteData(0x07);
-	LcdWriteData(0x31);
-	LcdWriteData(0xC1);
-	LcdWriteData(0x48);
-	LcdWriteData(0x08);
-	LcdWriteData(0x0F);
-	LcdWriteData(0x0C);
-	LcdWriteData(0x31);
-	LcdWriteData(0x36);
-	LcdWriteData(0x0F);
+/********************************************************************
+*
+*       _SetOrientation
+*
+* Function description:
+*   Configures the driver for a rotation of the panel. With GUI_SWAP_XY
+*   the logical screen is the physical one turned by 90 degrees, so the
+*   sizes are swapped as in LCD_X_Config() of the FlexColor template.
+*/
+static void _SetOrientation(LcdPanel_Rotation_t Rot) {
+  CONFIG_FLEXCOLOR Config = {0};
 
-	//exit sleep
-	LcdWriteReg(0x11);
-	HAL_Delay(120);
-	//display on
-	LcdWriteReg(0x29);
+  Config.Orientation = _aOrientation[Rot];
+  if (Config.Orientation & GUI_SWAP_XY) {
+    LCD_SetSizeEx (0, YSIZE_PHYS , XSIZE_PHYS);
+    LCD_SetVSizeEx(0, VYSIZE_PHYS, VXSIZE_PHYS);
+  } else {
+    LCD_SetSizeEx (0, XSIZE_PHYS , YSIZE_PHYS);
+    LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
+  }
+  GUIDRV_FlexColor_Config(_pDevice, &Config);
 }
 /*********************************************************************
 *
@@ -331,23 +226,15 @@ void LcdInit(void) {
 *
 */
 void LCD_X_Config(void) {
-  GUI_DEVICE * pDevice;
-  CONFIG_FLEXCOLOR Config = {0};
   GUI_PORT_API PortAPI = {0};
   //
   // Set display driver and color conversion
   //
-  pDevice = GUI_DEVICE_CreateAndLink(GUIDRV_FLEXCOLOR, GUICC_M565, 0, 0);//16bit color flexcolor driver, GUICC_M565=RGB, GUICC_565=BGR
+  _pDevice = GUI_DEVICE_CreateAndLink(GUIDRV_FLEXCOLOR, GUICC_M565, 0, 0);//16bit color flexcolor driver, GUICC_M565=RGB, GUICC_565=BGR
   //
-  // Display driver configuration, required for Lin-driver
+  // Display size and orientation, the same as the ones of the LVGL port
   //
-  LCD_SetSizeEx (0, XSIZE_PHYS , YSIZE_PHYS);
-  LCD_SetVSizeEx(0, VXSIZE_PHYS, VYSIZE_PHYS);
-  //
-  // Orientation
-  //
-  Config.Orientation = GUI_SWAP_XY;
-  GUIDRV_FlexColor_Config(pDevice, &Config);
+  _SetOrientation(LcdPanel_GetRotation());
   //
   // Set controller and operation mode
   //
@@ -362,7 +249,23 @@ void LCD_X_Config(void) {
   PortAPI.pfWriteM16_A1 = LcdWriteDataMultiple;
   PortAPI.pfReadM16_A1  = LcdReadDataMultiple;
 */
-  GUIDRV_FlexColor_SetFunc(pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66709, GUIDRV_FLEXCOLOR_M16C0B8);//ILI9341, 16bit color, 8 bit bus, no cache
+  GUIDRV_FlexColor_SetFunc(_pDevice, &PortAPI, GUIDRV_FLEXCOLOR_F66709, GUIDRV_FLEXCOLOR_M16C0B8);//ILI9341, 16bit color, 8 bit bus, no cache
+}
+
+/*********************************************************************
+*
+*       LcdConf_SetRotation
+*
+* Function description:
+*   Turns the panel and reconfigures the driver and the desktop window
+*   for the new logical size. To be called from the GUI task, the
+*   content of the windows is redrawn by the next GUI_Exec().
+*/
+void LcdConf_SetRotation(LcdPanel_Rotation_t Rot) {
+  LcdPanel_SetRotation(Rot);
+  _SetOrientation(LcdPanel_GetRotation());
+  WM_SetSize(WM_HBKWIN, LCD_GetXSize(), LCD_GetYSize());
+  WM_InvalidateWindow(WM_HBKWIN);
 }
 
 /*********************************************************************
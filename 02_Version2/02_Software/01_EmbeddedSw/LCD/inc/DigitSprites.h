@@ -0,0 +1,55 @@
+/**
+ * @file DigitSprites.h
+ *
+ * 7 segment digit sprites in RGB565 on black.
+ * Generated by LCD/tools/gen_digit_sprites.py, don't edit.
+ *
+ */
+
+#ifndef DIGITSPRITES_H
+#define DIGITSPRITES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DIGIT_SPRITE_W      32
+#define DIGIT_SPRITE_H      52
+
+/*Store the pixels high byte first (for LVGL with LV_COLOR_16_SWAP 1).
+ *Define it for the whole project, DigitSprites.c doesn't see lv_conf.h*/
+#ifndef DIGIT_SPRITES_16_SWAP
+#define DIGIT_SPRITES_16_SWAP 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    DIGIT_SPRITE_WHITE,
+    DIGIT_SPRITE_RED,
+    _DIGIT_SPRITE_COLOR_NUM
+} DigitSprite_Color_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+extern const uint16_t DigitSprites[_DIGIT_SPRITE_COLOR_NUM][10][DIGIT_SPRITE_W * DIGIT_SPRITE_H];
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* DIGITSPRITES_H */
@@ -14,7 +14,7 @@ extern "C" {
  *      INCLUDES
  *********************/
 #include <stdbool.h>
-#include "LCDConf.h"
+#include "LcdPanel.h"
 #ifndef LV_DRV_NO_CONF
 #ifdef LV_CONF_INCLUDE_SIMPLE
 #include "lv_drv_conf.h"
@@ -35,22 +35,22 @@ extern "C" {
 #error "ILI9341 currently supports 'LV_COLOR_DEPTH == 16'. Set it in lv_conf.h"
 #endif
 
-#if LV_COLOR_16_SWAP != 1
-//#error "ILI9341 SPI requires LV_COLOR_16_SWAP == 1. Set it in lv_conf.h"
+/*The panel takes the high byte of a pixel first.
+ *With LV_COLOR_16_SWAP LVGL renders the pixels in this order, else the flush swaps the bytes
+ *while writing them (cheaper than swapping in every draw function).
+ *Red and blue follow MADCTL_BGR, no conversion is needed for them.*/
+#if LV_COLOR_16_SWAP
+#define ILI9341_PIXEL_SWAP  0
+#else
+#define ILI9341_PIXEL_SWAP  1
 #endif
 
 /*********************
  *      DEFINES
  *********************/
-#define ILI9341_BGR true
-#define ILI9341_RGB false
-
 #define ILI9341_CMD_MODE    0
 #define ILI9341_DATA_MODE   1
 
-#define ILI9341_TFTWIDTH    240
-#define ILI9341_TFTHEIGHT   320
-
 /**********************
  *      TYPEDEFS
  **********************/
@@ -60,7 +60,7 @@ extern "C" {
  **********************/
 void ili9341_init(void);
 void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
-void ili9341_rotate(int degrees, bool bgr);
+void ili9341_update(lv_disp_drv_t * drv);
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,97 @@
+/**
+ * @file LcdBacklight.h
+ *
+ * Backlight of the ILI9341 module: brightness with the display brightness
+ * registers of the panel (WRDISBV, WRCTRLD), dimmed and switched off by the
+ * sleep state of the soldering iron.
+ *
+ */
+
+#ifndef LCDBACKLIGHT_H
+#define LCDBACKLIGHT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "LcdPanel.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LCD_BACKLIGHT_LEVEL_ON
+#define LCD_BACKLIGHT_LEVEL_ON      255     /*brightness while the iron is used*/
+#endif
+
+#ifndef LCD_BACKLIGHT_LEVEL_DIM
+#define LCD_BACKLIGHT_LEVEL_DIM     40      /*brightness while the iron rests in the holder*/
+#endif
+
+#ifndef LCD_BACKLIGHT_DIM_DELAY
+#define LCD_BACKLIGHT_DIM_DELAY     3000    /*[ms] in the holder before dimming*/
+#endif
+
+#ifndef LCD_BACKLIGHT_OFF_DELAY
+#define LCD_BACKLIGHT_OFF_DELAY     600000  /*[ms] in the holder before the deep standby*/
+#endif
+
+/*Length of the hardware fade (display dimming, BLCTRL5). The panel is put to sleep
+ *only after the fade out has finished.*/
+#ifndef LCD_BACKLIGHT_FADE_TIME
+#define LCD_BACKLIGHT_FADE_TIME     500     /*[ms]*/
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    LCD_BACKLIGHT_ON,
+    LCD_BACKLIGHT_DIM,
+    LCD_BACKLIGHT_FADE_OFF,     /*fading out before the deep standby*/
+    LCD_BACKLIGHT_OFF,          /*deep standby: backlight off, panel in sleep mode*/
+} LcdBacklight_State_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start from full brightness. LcdPanel_Init() has to be called before it.
+ * @param tick current time in ms
+ */
+void LcdBacklight_Init(uint32_t tick);
+
+/**
+ * Run the backlight state machine. Call it periodically from the task owning the panel.
+ * @param in_holder true: the iron is in the holder
+ * @param activity true: the user did something since the last call (encoder, button)
+ * @param tick current time in ms
+ */
+void LcdBacklight_Handler(bool in_holder, bool activity, uint32_t tick);
+
+/**
+ * Set the brightness. The panel fades to it without the CPU.
+ * @param level 0 (dark) ... 255 (full brightness)
+ */
+void LcdBacklight_SetBrightness(uint8_t level);
+
+/**
+ * Get the state of the backlight
+ * @return the state
+ */
+LcdBacklight_State_t LcdBacklight_GetState(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LCDBACKLIGHT_H */
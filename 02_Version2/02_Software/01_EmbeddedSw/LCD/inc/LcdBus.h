@@ -0,0 +1,117 @@
+/**
+ * @file LcdBus.h
+ *
+ * 8080 8 bit parallel bus of the ILI9341 panel.
+ * Shared by the emWin (LCDConf.c) and the LVGL (ILI9341.c) back ends.
+ *
+ */
+
+#ifndef LCDBUS_H
+#define LCDBUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/*Called when an asynchronous transfer has been finished*/
+typedef void (*LcdBus_DoneCb_t)(void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Set the idle levels of the control lines (CS, RS, WR, RD high)
+ */
+void LcdBus_Init(void);
+
+/**
+ * Hardware reset of the panel with the RST line
+ */
+void LcdBus_Reset(void);
+
+/**
+ * Blocking delay used by the panel sequences
+ * @param ms delay in milliseconds
+ */
+void LcdBus_DelayMs(uint32_t ms);
+
+/**
+ * Write a command byte (RS low)
+ * @param cmd the command
+ */
+void LcdBus_WriteReg(uint8_t cmd);
+
+/**
+ * Write a parameter/data byte (RS high)
+ * @param data the byte to write
+ */
+void LcdBus_WriteData(uint8_t data);
+
+/**
+ * Write data bytes in a blocking way
+ * @param pData pointer to the bytes
+ * @param NumItems number of bytes
+ */
+void LcdBus_WriteDataMultiple(const uint8_t * pData, uint32_t NumItems);
+
+/**
+ * Start writing data bytes and return as soon as the bus allows it.
+ * `cb` is called when the transfer is finished, `pData` has to remain valid until then.
+ * @param pData pointer to the bytes
+ * @param NumItems number of bytes
+ * @param cb callback to call when ready (can be NULL)
+ * @param user_data passed to `cb`
+ */
+void LcdBus_WriteDataMultipleAsync(const uint8_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb, void * user_data);
+
+/**
+ * Write 16 bit words in a blocking way, high byte first (e.g. RGB565 pixels in native byte order)
+ * @param pData pointer to the words
+ * @param NumItems number of words
+ */
+void LcdBus_WriteData16Multiple(const uint16_t * pData, uint32_t NumItems);
+
+/**
+ * Asynchronous version of LcdBus_WriteData16Multiple()
+ * @param pData pointer to the words
+ * @param NumItems number of words
+ * @param cb callback to call when ready (can be NULL)
+ * @param user_data passed to `cb`
+ */
+void LcdBus_WriteData16MultipleAsync(const uint16_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb,
+                                     void * user_data);
+
+/**
+ * Tell whether an asynchronous transfer is in progress
+ * @return true: busy
+ */
+bool LcdBus_IsBusy(void);
+
+/**
+ * Wait until the asynchronous transfer in progress is finished
+ */
+void LcdBus_WaitIdle(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LCDBUS_H */
@@ -0,0 +1,43 @@
+/**
+ * @file lv_port_bench.h
+ *
+ * Runs the LVGL benchmark (lvgl/demos/benchmark) on the display of lv_port_disp.c.
+ * Only in the benchmark build (LV_PORT_BENCHMARK in lv_conf.h). The demo logs the FPS of
+ * every scene and the weighted FPS at the end, this module adds the rendering and the
+ * flushing time of the frames of the scene before each result. Everything is printed with
+ * LV_LOG (printf, USART2 on the target).
+ *
+ */
+
+#ifndef LV_PORT_BENCH_H
+#define LV_PORT_BENCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+
+#if LV_USE_DEMO_BENCHMARK
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Start the benchmark on the active screen. It runs from `lv_timer_handler()`,
+ * about a minute with two passes (opaque and semi transparent) of every scene.
+ * `lv_port_disp_init()` has to be called before it.
+ */
+void lv_port_bench_start(void);
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_BENCH_H */
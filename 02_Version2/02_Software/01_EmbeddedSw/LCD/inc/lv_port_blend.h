@@ -0,0 +1,61 @@
+/**
+ * @file lv_port_blend.h
+ *
+ * Blending of the software renderer for the Cortex-M4 (the F446 has no DMA2D).
+ * Replaces the `blend` callback of the draw context of LVGL for RGB565 with normal blending:
+ * opaque fills with 64-bit stores, the masks are scanned by words and the foreground color
+ * of a fill is prepared once, the scaled mask of two pixels is computed with one multiply.
+ * The pixels are the same as with `lv_draw_sw_blend_basic()` (lv_color_mix()), every other
+ * case (other blend modes, ARGB layers, no anti-aliasing) is passed to it.
+ *
+ */
+
+#ifndef LV_PORT_BLEND_H
+#define LV_PORT_BLEND_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "lvgl/src/draw/sw/lv_draw_sw.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*1: use lv_port_blend() (lv_port_disp.c); only for the 16 bit colors of lv_color_mix()*/
+#ifndef LV_PORT_BLEND
+#define LV_PORT_BLEND   (LV_COLOR_DEPTH == 16 && LV_COLOR_MIX_ROUND_OFS == 0)
+#endif
+
+#if LV_PORT_BLEND
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize a software draw context with lv_port_blend() (`draw_ctx_init` of the display driver).
+ * The size of the context is `sizeof(lv_draw_sw_ctx_t)`.
+ * @param drv       the display driver
+ * @param draw_ctx  the draw context to initialize
+ */
+void lv_port_blend_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx);
+
+/**
+ * Blend a color or an image into the draw buffer as `lv_draw_sw_blend_basic()` does.
+ * @param draw_ctx  the draw context, the buffer of the refreshed display
+ * @param dsc       the descriptor of the blending
+ */
+void lv_port_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+#endif /*LV_PORT_BLEND*/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_BLEND_H */
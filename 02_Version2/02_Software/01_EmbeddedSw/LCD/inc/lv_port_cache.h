@@ -0,0 +1,97 @@
+/**
+ * @file lv_port_cache.h
+ *
+ * Statistics and pre-warming of the caches of the LVGL draw engine. The sizes of the
+ * caches are set in lv_conf.h, LVGL reports every lookup through LV_CACHE_STATS().
+ * A steady frame of a pre-warmed screen should have no misses.
+ *
+ * Used from the GUI task only.
+ * LVGL includes it through lv_conf_internal.h (LV_CACHE_STATS_INCLUDE): it mustn't include lvgl.h.
+ *
+ */
+
+#ifndef LV_PORT_CACHE_H
+#define LV_PORT_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+struct _lv_obj_t;
+
+typedef enum {
+    LV_PORT_CACHE_IMG,      /*opened images (LV_IMG_CACHE_DEF_SIZE)*/
+    LV_PORT_CACHE_GRAD,     /*gradient maps (LV_GRAD_CACHE_DEF_SIZE)*/
+    LV_PORT_CACHE_CIRCLE,   /*anti-aliased quarter circles of the radius masks (LV_CIRCLE_CACHE_SIZE)*/
+    LV_PORT_CACHE_SHADOW,   /*the last shadow corner (LV_SHADOW_CACHE_SIZE)*/
+    LV_PORT_CACHE_CORNER,   /*corners of rounded rectangles and borders (LV_RECT_CORNER_CACHE_SIZE)*/
+    LV_PORT_CACHE_GLYPH,    /*expanded letters (LV_GLYPH_CACHE_SIZE)*/
+    LV_PORT_CACHE_LAYOUT,   /*the size and the lines of the texts of the labels (LV_LABEL_LAYOUT_CACHE)*/
+    LV_PORT_CACHE_STYLE,    /*the properties set in the styles of the objects (LV_OBJ_STYLE_CACHE)*/
+    _LV_PORT_CACHE_NUM
+} lv_port_cache_t;
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;        /*the data had to be computed or opened*/
+} lv_port_cache_stats_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Count a lookup in a cache (LV_CACHE_STATS in lv_conf.h)
+ * @param cache the cache
+ * @param hit   true: the data was found in the cache
+ */
+void lv_port_cache_count(lv_port_cache_t cache, bool hit);
+
+/**
+ * Get the statistics of a cache collected since the last lv_port_cache_clear_stats()
+ * @param cache the cache
+ * @return      pointer to the statistics
+ */
+const lv_port_cache_stats_t * lv_port_cache_get_stats(lv_port_cache_t cache);
+
+/**
+ * Zero the statistics of every cache
+ */
+void lv_port_cache_clear_stats(void);
+
+/**
+ * Put the images and the background gradients of an object and its children into the caches,
+ * so the first frame showing them doesn't have to open or compute them
+ * @param obj   e.g. a screen
+ */
+void lv_port_cache_prewarm(struct _lv_obj_t * obj);
+
+/**
+ * Put an image into the image cache as an `lv_img` without recoloring draws it,
+ * e.g. the images which are not shown yet
+ * @param src   the image source
+ */
+void lv_port_cache_prewarm_img(const void * src);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_CACHE_H */
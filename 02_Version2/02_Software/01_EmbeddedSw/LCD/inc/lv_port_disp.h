@@ -0,0 +1,149 @@
+/**
+ * @file lv_port_disp.h
+ *
+ * LVGL display port of the ILI9341 panel.
+ * The firmware and the host tests (Test/) register the display with the same code.
+ * The time of the refreshes is measured (Perf.h) to tell rendering and flushing apart.
+ *
+ */
+
+#ifndef LV_PORT_DISP_H
+#define LV_PORT_DISP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "ILI9341.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Rows of the longer side of the panel in a draw buffer: a stripe across the screen
+ *in any rotation is flushed with one window setup*/
+#ifndef LV_PORT_DISP_BUF_LINES
+#define LV_PORT_DISP_BUF_LINES  24
+#endif
+
+/*1: a second draw buffer to render into while the other is flushed (useful with a DMA bus only)*/
+#ifndef LV_PORT_DISP_DOUBLE_BUF
+#define LV_PORT_DISP_DOUBLE_BUF 0
+#endif
+
+/*Size of one draw buffer in pixels*/
+#define LV_PORT_DISP_BUF_SIZE   (LCD_PANEL_HEIGHT * LV_PORT_DISP_BUF_LINES)
+
+/*The default cost profile of the joining of the invalid areas (lv_port_disp_cost_t).
+ *The bus costs are measured by lv_port_disp_calibrate_cost() on the target at 180 MHz.
+ *The rendering costs are typical of the station screens: the walk of the object tree
+ *for every stripe and the background, borders and letters of a pixel.*/
+#ifndef LV_PORT_DISP_COST_WINDOW_NS
+#define LV_PORT_DISP_COST_WINDOW_NS     1500
+#endif
+#ifndef LV_PORT_DISP_COST_PX_NS
+#define LV_PORT_DISP_COST_PX_NS         80
+#endif
+#ifndef LV_PORT_DISP_COST_STRIPE_NS
+#define LV_PORT_DISP_COST_STRIPE_NS     20000
+#endif
+#ifndef LV_PORT_DISP_COST_RENDER_PX_NS
+#define LV_PORT_DISP_COST_RENDER_PX_NS  40
+#endif
+
+/*1: measure the bus costs in lv_port_disp_init(). Only on the target: the tests of the
+ *host have to join the areas the same way on every run.*/
+#ifndef LV_PORT_DISP_CALIBRATE
+#ifdef USE_HAL_DRIVER
+#define LV_PORT_DISP_CALIBRATE  1
+#else
+#define LV_PORT_DISP_CALIBRATE  0
+#endif
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t refreshes;
+    uint32_t flushes;
+    uint32_t px;            /*pixels sent to the panel*/
+    uint32_t drawn_px;      /*pixels drawn by the objects (lv_refr_get_overdraw()), `drawn_px / px` is the overdraw*/
+    uint32_t skipped_px;    /*pixels of backgrounds covered by opaque children, not drawn (LV_REFR_OCCLUSION)*/
+    uint32_t refr_us;       /*[us] from the start of rendering to the end of the last flush*/
+    uint32_t flush_us;      /*[us] in the flush callback: sending the pixels to the panel*/
+} lv_port_disp_stats_t;
+
+/*Time of refreshing an area: every stripe of the draw buffer is rendered and flushed
+ *with one window setup, then every pixel is rendered and sent*/
+typedef struct {
+    uint32_t window_ns;     /*[ns] a flush without the pixels: CASET, PASET, RAMWR*/
+    uint32_t px_ns;         /*[ns] sending a pixel*/
+    uint32_t stripe_ns;     /*[ns] rendering a stripe without the pixels: the walk of the object tree*/
+    uint32_t render_px_ns;  /*[ns] rendering a pixel*/
+} lv_port_disp_cost_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the panel and register it as an LVGL display.
+ * `lv_init()` has to be called before it.
+ * The display starts in LCD_PANEL_ROTATION and can be turned with `lv_disp_set_rotation()`
+ * from the GUI task. The rotation is done by the panel, it costs nothing per pixel.
+ * @return the created display
+ */
+lv_disp_t * lv_port_disp_init(void);
+
+/**
+ * Use only a part of the draw buffers, e.g. to measure the frame time with smaller buffers.
+ * Call it between two refreshes.
+ * @param lines         rows of the longer side of the panel, at most LV_PORT_DISP_BUF_LINES
+ * @param double_buf    true: use the second buffer too (only with LV_PORT_DISP_DOUBLE_BUF)
+ */
+void lv_port_disp_set_buf_lines(uint32_t lines, bool double_buf);
+
+/**
+ * Set the cost profile of the joining of the invalid areas (`area_cost_cb` of the driver).
+ * LVGL joins the areas which are cheaper to refresh together, also the ones without common parts.
+ * @param cost      the new profile (copied), NULL: join only the overlapping areas as LVGL does
+ */
+void lv_port_disp_set_cost(const lv_port_disp_cost_t * cost);
+
+/**
+ * Get the cost profile of the joining of the invalid areas
+ * @return      pointer to the profile, NULL if not used
+ */
+const lv_port_disp_cost_t * lv_port_disp_get_cost(void);
+
+/**
+ * Measure the bus costs of the profile (window setup, pixel) with flushes of the first row.
+ * Overwrites the first row of the panel: call it before the first refresh
+ * (done by lv_port_disp_init() with LV_PORT_DISP_CALIBRATE).
+ */
+void lv_port_disp_calibrate_cost(void);
+
+/**
+ * Get the statistics of the refreshes since the last lv_port_disp_clear_stats().
+ * The rendering time is `refr_us - flush_us` (the bus is synchronous).
+ * @return      pointer to the statistics
+ */
+const lv_port_disp_stats_t * lv_port_disp_get_stats(void);
+
+/**
+ * Zero the statistics of the refreshes
+ */
+void lv_port_disp_clear_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_DISP_H */
@@ -0,0 +1,67 @@
+/**
+ * @file lv_port_indev.h
+ *
+ * LVGL input device port of the rotary encoder (Encoder.c).
+ * The read timer of the input device is paused: the GUI task reads it with
+ * lv_port_indev_process() only when the encoder or the button has done something,
+ * and while the button is held (for the long press).
+ *
+ */
+
+#ifndef LV_PORT_INDEV_H
+#define LV_PORT_INDEV_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "Encoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_PORT_INDEV_LONG_PRESS_TIME
+#define LV_PORT_INDEV_LONG_PRESS_TIME   1000    /*[ms] holding the button this long switches the screen (freertos.c)*/
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Register the encoder as an LVGL input device with a group, which is also the default group:
+ * the focusable objects created after it can be reached with the encoder.
+ * `lv_port_disp_init()` has to be called before it.
+ * @return the created input device
+ */
+lv_indev_t * lv_port_indev_init(void);
+
+/**
+ * Pass the new button edges and the detents of ENCODER_TARGET_GUI to LVGL.
+ * Call it from the GUI task before `lv_timer_handler()`, it does nothing if there is no input.
+ */
+void lv_port_indev_process(void);
+
+/**
+ * Get the group of the encoder
+ * @return the group
+ */
+lv_group_t * lv_port_indev_get_group(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_INDEV_H */
@@ -0,0 +1,162 @@
+/**
+ * @file lv_port_mem.h
+ *
+ * Memory of LVGL (LV_MEM_CUSTOM_ALLOC/FREE/REALLOC in lv_conf.h).
+ * With LV_MEM_CUSTOM_TLSF it is a TLSF pool of LV_MEM_SIZE bytes in the `.lvgl_pool`
+ * section, otherwise it is taken from the FreeRTOS heap (pvPortMalloc).
+ * Every allocation is counted in a size class, so the peak usage and the mix of
+ * the sizes show how much the pool can be shrunk.
+ * With LV_PORT_MEM_SLAB the fixed size internals of LVGL started and ended all the time
+ * (animations, timers, event descriptors) come from slabs in O(1): pages of TLSF cut to
+ * blocks of one size. The statistics count the blocks of the slabs, not their pages.
+ *
+ * Used from the GUI task only.
+ *
+ */
+
+#ifndef LV_PORT_MEM_H
+#define LV_PORT_MEM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Size classes: <= 16, <= 32, ... <= 4096 and larger*/
+#define LV_PORT_MEM_CLASS_MIN   16
+#define LV_PORT_MEM_CLASS_NUM   10
+
+/*1: serve the allocations of LV_PORT_MEM_SLAB_SIZES from slabs (only with the TLSF pool)*/
+#ifndef LV_PORT_MEM_SLAB
+#define LV_PORT_MEM_SLAB        LV_MEM_CUSTOM_TLSF
+#endif
+#if LV_PORT_MEM_SLAB && !LV_MEM_CUSTOM_TLSF
+#error "LV_PORT_MEM_SLAB needs LV_MEM_CUSTOM_TLSF"
+#endif
+
+/*Blocks in a page of a slab*/
+#ifndef LV_PORT_MEM_SLAB_PAGE_BLOCKS
+#define LV_PORT_MEM_SLAB_PAGE_BLOCKS    8
+#endif
+
+/*[bytes] the allocations served by the slabs, the other sizes (objects, styles, texts) fit better
+ *in TLSF: the list nodes of the animations and the timers, the event descriptors (callback,
+ *user data, filter) of the objects with one and two callbacks*/
+#ifndef LV_PORT_MEM_SLAB_SIZES
+#define LV_PORT_MEM_SLAB_SIZES  {sizeof(lv_anim_t) + 2 * sizeof(void *), sizeof(lv_timer_t) + 2 * sizeof(void *), \
+                                 3 * sizeof(void *), 6 * sizeof(void *)}
+#define LV_PORT_MEM_SLAB_NUM    4
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t allocs;        /*allocations since the last reset*/
+    uint32_t used;          /*blocks in use*/
+    uint32_t peak;          /*most blocks in use at once*/
+} lv_port_mem_class_t;
+
+typedef struct {
+    uint32_t size;          /*[bytes] of the blocks, one word more than the allocations*/
+    uint32_t pages;         /*pages of the slab*/
+    uint32_t allocs;        /*allocations since the last reset*/
+    uint32_t used;          /*blocks in use*/
+    uint32_t peak;          /*most blocks in use at once*/
+    uint32_t page_allocs;   /*pages taken from TLSF since the last reset*/
+    uint32_t fallbacks;     /*allocations served by TLSF because it had no memory for a page*/
+} lv_port_mem_slab_t;
+
+typedef struct {
+    uint32_t cur_used;      /*[bytes] in use, the size of the blocks with their rounding*/
+    uint32_t max_used;      /*[bytes] most in use at once*/
+    uint32_t fails;         /*allocations which couldn't be served*/
+    lv_port_mem_class_t classes[LV_PORT_MEM_CLASS_NUM];
+#if LV_PORT_MEM_SLAB
+    lv_port_mem_slab_t slabs[LV_PORT_MEM_SLAB_NUM];
+#endif
+} lv_port_mem_stats_t;
+
+typedef struct {
+    uint32_t total_size;    /*[bytes] of the pool*/
+    uint32_t free_size;     /*[bytes] in TLSF*/
+    uint32_t free_biggest_size;
+    uint32_t free_cnt;
+    uint32_t used_cnt;      /*blocks of TLSF and the slabs*/
+    uint32_t slab_free_size;    /*[bytes] free blocks in the pages of the slabs*/
+    uint8_t frag_pct;       /*the part of the free memory of TLSF not in the biggest free block*/
+    uint32_t free_blocks[LV_PORT_MEM_CLASS_NUM];    /*free blocks per size class*/
+} lv_port_mem_report_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Allocate memory for LVGL (LV_MEM_CUSTOM_ALLOC)
+ * @param size  [bytes]
+ * @return      the memory or NULL
+ */
+void * lv_port_mem_alloc(size_t size);
+
+/**
+ * Free memory of lv_port_mem_alloc() or lv_port_mem_realloc() (LV_MEM_CUSTOM_FREE)
+ * @param p     the memory (can be NULL)
+ */
+void lv_port_mem_free(void * p);
+
+/**
+ * Resize memory (LV_MEM_CUSTOM_REALLOC)
+ * @param p     the memory or NULL to allocate
+ * @param size  [bytes] new size
+ * @return      the memory or NULL: `p` is left unchanged
+ */
+void * lv_port_mem_realloc(void * p, size_t size);
+
+/**
+ * Fill the data of lv_mem_monitor() (LV_MEM_CUSTOM_MONITOR)
+ * @param mon_p store the result here
+ */
+void lv_port_mem_monitor(lv_mem_monitor_t * mon_p);
+
+/**
+ * Walk the free and used blocks of the memory
+ * @param report store the result here
+ */
+void lv_port_mem_report(lv_port_mem_report_t * report);
+
+#if LV_PORT_MEM_SLAB
+/**
+ * Give the empty pages of the slabs back to TLSF. Called when TLSF runs out of memory.
+ * @return the number of pages given back
+ */
+uint32_t lv_port_mem_trim(void);
+#endif
+
+/**
+ * Get the statistics of the allocations
+ * @return pointer to the statistics
+ */
+const lv_port_mem_stats_t * lv_port_mem_get_stats(void);
+
+/**
+ * Zero the counters and start the peaks from the current usage
+ */
+void lv_port_mem_clear_stats(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LV_PORT_MEM_H */
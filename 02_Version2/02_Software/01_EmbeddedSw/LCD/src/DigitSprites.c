@@ -0,0 +1,1110 @@
+/**
+ * @file DigitSprites.c
+ *
+ * Generated by LCD/tools/gen_digit_sprites.py, don't edit.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "DigitSprites.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if DIGIT_SPRITES_16_SWAP
+#define PX(c)   ((uint16_t)(((c) >> 8) | (((c) & 0xFF) << 8)))
+#else
+#define PX(c)   (c)
+#endif
+
+/**********************
+ *   GLOBAL VARIABLES
+ **********************/
+const uint16_t DigitSprites[_DIGIT_SPRITE_COLOR_NUM][10][DIGIT_SPRITE_W * DIGIT_SPRITE_H] = {
+    [DIGIT_SPRITE_WHITE] = {
+        /*0*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*1*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*2*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*3*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*4*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*5*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*6*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*7*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*8*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*9*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x9CF3), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9CF3), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0xFFFF), PX(0x630C), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+    },
+    [DIGIT_SPRITE_RED] = {
+        /*0*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*1*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*2*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*3*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*4*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*5*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*6*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*7*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*8*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+        /*9*/ {
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x9800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x9800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0xF800), PX(0x6000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+            PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000), PX(0x0000),
+        },
+    },
+};
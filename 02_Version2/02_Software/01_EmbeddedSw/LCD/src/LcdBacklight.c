@@ -0,0 +1,131 @@
+/**
+ * @file LcdBacklight.c
+ *
+ * The board has no backlight pin: the LED of the module is driven through the
+ * brightness control of the ILI9341 (WRDISBV, WRCTRLD BCTRL/BL). With the display
+ * dimming bit (DD) the controller fades between the levels by itself.
+ *
+ *  ON --(in holder for DIM_DELAY)--> DIM --(in holder for OFF_DELAY)--> FADE_OFF --(FADE_TIME)--> OFF
+ *  any state --(out of the holder or activity)--> ON
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdBacklight.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void state_set(LcdBacklight_State_t new_state, uint32_t tick);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static LcdBacklight_State_t state;
+static uint32_t state_tick;         /*when the current state has been entered*/
+static uint32_t holder_tick;        /*since when the iron rests without activity*/
+static bool holder_prev;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LcdBacklight_Init(uint32_t tick)
+{
+    state = LCD_BACKLIGHT_ON;
+    state_tick = tick;
+    holder_tick = tick;
+    holder_prev = false;
+    LcdBacklight_SetBrightness(LCD_BACKLIGHT_LEVEL_ON);
+}
+
+void LcdBacklight_Handler(bool in_holder, bool activity, uint32_t tick)
+{
+    /*Restart the timers when the iron is put into the holder or the user does something*/
+    if(activity || (in_holder && !holder_prev)) holder_tick = tick;
+    holder_prev = in_holder;
+
+    if(!in_holder || activity) {
+        state_set(LCD_BACKLIGHT_ON, tick);
+        return;
+    }
+
+    uint32_t rest = tick - holder_tick;
+    switch(state) {
+        case LCD_BACKLIGHT_ON:
+            if(rest >= LCD_BACKLIGHT_DIM_DELAY) state_set(LCD_BACKLIGHT_DIM, tick);
+            break;
+        case LCD_BACKLIGHT_DIM:
+            if(rest >= LCD_BACKLIGHT_OFF_DELAY) state_set(LCD_BACKLIGHT_FADE_OFF, tick);
+            break;
+        case LCD_BACKLIGHT_FADE_OFF:
+            if(tick - state_tick >= LCD_BACKLIGHT_FADE_TIME) state_set(LCD_BACKLIGHT_OFF, tick);
+            break;
+        case LCD_BACKLIGHT_OFF:
+        default:
+            break;
+    }
+}
+
+void LcdBacklight_SetBrightness(uint8_t level)
+{
+    LcdBus_WaitIdle();
+    LcdBus_WriteReg(ILI9341_WRDISBV);
+    LcdBus_WriteData(level);
+}
+
+LcdBacklight_State_t LcdBacklight_GetState(void)
+{
+    return state;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void state_set(LcdBacklight_State_t new_state, uint32_t tick)
+{
+    if(new_state == state) return;
+
+    /*Wake up the panel from the deep standby first, GRAM has been kept*/
+    if(state == LCD_BACKLIGHT_OFF) {
+        LcdBus_WaitIdle();
+        LcdBus_WriteReg(ILI9341_SLPOUT);
+        LcdBus_DelayMs(120);
+        LcdBus_WriteReg(ILI9341_DISPON);
+    }
+
+    switch(new_state) {
+        case LCD_BACKLIGHT_ON:
+            LcdBacklight_SetBrightness(LCD_BACKLIGHT_LEVEL_ON);
+            break;
+        case LCD_BACKLIGHT_DIM:
+            LcdBacklight_SetBrightness(LCD_BACKLIGHT_LEVEL_DIM);
+            break;
+        case LCD_BACKLIGHT_FADE_OFF:
+            LcdBacklight_SetBrightness(0);
+            break;
+        case LCD_BACKLIGHT_OFF:
+            LcdBus_WaitIdle();
+            LcdBus_WriteReg(ILI9341_DISPOFF);
+            LcdBus_WriteReg(ILI9341_SLPIN);
+            break;
+    }
+
+    state = new_state;
+    state_tick = tick;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file LcdBus.c
+ *
+ * 8080 8 bit parallel bus of the ILI9341 panel driven from GPIO.
+ * D0..D7 are PB0..PB7, the control lines are on GPIOB too so one BSRR write
+ * sets the data byte and the control lines at the same time.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdBus.h"
+#include "main.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LCD_BUS_PORT    GPIOB   /*D0..D7, CS, RS, WR and RD*/
+
+/*BSRR words of the control lines*/
+#define LCD_CS_H        ((uint32_t)LCD_CS_Pin)
+#define LCD_CS_L        ((uint32_t)LCD_CS_Pin << 16)
+#define LCD_RS_H        ((uint32_t)LCD_RS_Pin)
+#define LCD_RS_L        ((uint32_t)LCD_RS_Pin << 16)
+#define LCD_WR_H        ((uint32_t)LCD_WR_Pin)
+#define LCD_WR_L        ((uint32_t)LCD_WR_Pin << 16)
+#define LCD_RD_H        ((uint32_t)LCD_RD_Pin)
+
+/*BSRR word putting `d` to D0..D7: set the 1 bits, reset the 0 bits*/
+#define LCD_BSRR_DATA(d) ((uint32_t)(uint8_t)(d) | ((uint32_t)(uint8_t)~(d) << 16))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+/*Strobe one byte to the bus, CS and RS have to be set already*/
+#define LCD_WRITE_BYTE(b)                                           \
+    do {                                                            \
+        uint8_t d_ = (uint8_t)(b);                                  \
+        LCD_BUS_PORT->BSRR = LCD_BSRR_DATA(d_) | LCD_WR_L;          \
+        LCD_BUS_PORT->BSRR = LCD_WR_H;                              \
+    } while(0)
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LcdBus_Init(void)
+{
+    LCD_BUS_PORT->BSRR = LCD_CS_H | LCD_RS_H | LCD_WR_H | LCD_RD_H;
+}
+
+void LcdBus_Reset(void)
+{
+    HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_RESET);
+    LcdBus_Init();
+    HAL_Delay(2);
+    HAL_GPIO_WritePin(LCD_RST_GPIO_Port, LCD_RST_Pin, GPIO_PIN_SET);
+}
+
+void LcdBus_DelayMs(uint32_t ms)
+{
+    HAL_Delay(ms);
+}
+
+void LcdBus_WriteReg(uint8_t cmd)
+{
+    LCD_BUS_PORT->BSRR = LCD_BSRR_DATA(cmd) | LCD_RS_L | LCD_CS_L | LCD_WR_L;
+    LCD_BUS_PORT->BSRR = LCD_WR_H | LCD_CS_H;
+}
+
+void LcdBus_WriteData(uint8_t data)
+{
+    LCD_BUS_PORT->BSRR = LCD_BSRR_DATA(data) | LCD_RS_H | LCD_CS_L | LCD_WR_L;
+    LCD_BUS_PORT->BSRR = LCD_WR_H | LCD_CS_H;
+}
+
+void LcdBus_WriteDataMultiple(const uint8_t * pData, uint32_t NumItems)
+{
+    /*Keep CS low for the whole burst, only WR is strobed per byte*/
+    LCD_BUS_PORT->BSRR = LCD_RS_H | LCD_CS_L;
+    while(NumItems--) {
+        LCD_WRITE_BYTE(*pData++);
+    }
+    LCD_BUS_PORT->BSRR = LCD_CS_H;
+}
+
+void LcdBus_WriteData16Multiple(const uint16_t * pData, uint32_t NumItems)
+{
+    LCD_BUS_PORT->BSRR = LCD_RS_H | LCD_CS_L;
+
+    /*Go to a word boundary to handle two pixels with one load*/
+    if(((uint32_t)pData & 0x2) && NumItems) {
+        uint16_t c = *pData++;
+        LCD_WRITE_BYTE(c >> 8);
+        LCD_WRITE_BYTE(c);
+        NumItems--;
+    }
+
+    /*__REV16 swaps the bytes of both halfwords: the word is in bus order from its LSB*/
+    const uint32_t * pWord = (const uint32_t *)pData;
+    uint32_t n = NumItems >> 1;
+    while(n--) {
+        uint32_t w = __REV16(*pWord++);
+        LCD_WRITE_BYTE(w);
+        LCD_WRITE_BYTE(w >> 8);
+        LCD_WRITE_BYTE(w >> 16);
+        LCD_WRITE_BYTE(w >> 24);
+    }
+
+    if(NumItems & 1) {
+        uint16_t c = *(const uint16_t *)pWord;
+        LCD_WRITE_BYTE(c >> 8);
+        LCD_WRITE_BYTE(c);
+    }
+    LCD_BUS_PORT->BSRR = LCD_CS_H;
+}
+
+/**
+ * PB0..PB7 are not FMC data lines and WR is not a timer output on this board,
+ * so no peripheral can clock the bytes out in the background. The transfer runs
+ * here and completes before returning; a DMA capable bus only has to replace this function.
+ */
+void LcdBus_WriteDataMultipleAsync(const uint8_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb, void * user_data)
+{
+    LcdBus_WriteDataMultiple(pData, NumItems);
+    if(cb) cb(user_data);
+}
+
+void LcdBus_WriteData16MultipleAsync(const uint16_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb,
+                                     void * user_data)
+{
+    LcdBus_WriteData16Multiple(pData, NumItems);
+    if(cb) cb(user_data);
+}
+
+bool LcdBus_IsBusy(void)
+{
+    return false;
+}
+
+void LcdBus_WaitIdle(void)
+{
+    while(LcdBus_IsBusy());
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
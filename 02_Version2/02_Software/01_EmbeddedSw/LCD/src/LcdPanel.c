@@ -0,0 +1,158 @@
+/**
+ * @file LcdPanel.c
+ *
+ * ILI9341 panel layer: init sequence and GRAM window.
+ * The emWin and the LVGL back ends both initialize the panel from here.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdPanel.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const uint8_t init_seq[] = {
+    /*three extra NOPs to sync the bus after reset*/
+    ILI9341_NOP,        0,
+    ILI9341_NOP,        0,
+    ILI9341_NOP,        0,
+    ILI9341_SWRESET,    0 | LCD_SEQ_DELAY, 10,
+    ILI9341_PWCTRLA,    5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    ILI9341_PWCTRLB,    3, 0x00, 0xC1, 0x30,
+    ILI9341_TIMECTRLA_INT, 3, 0x85, 0x00, 0x78,
+    ILI9341_TIMECTRLB,  2, 0x00, 0x00,
+    ILI9341_PWSEQCTRL,  4, 0x64, 0x03, 0x12, 0x81,
+    ILI9341_PUMPRATIO,  1, 0x20,
+    ILI9341_PWCTRL1,    1, 0x23,                    /*VRH[5:0]*/
+    ILI9341_PWCTRL2,    1, 0x10,                    /*SAP[2:0];BT[3:0]*/
+    ILI9341_VMCTRL1,    2, 0x3E, 0x28,
+    ILI9341_VMCTRL2,    1, 0x86,
+    ILI9341_PIXSET,     1, 0x55,                    /*16 bit pixel*/
+    ILI9341_FRMCTR1,    2, 0x00, 0x18,              /*normal mode, full colours*/
+    ILI9341_DISCTRL,    3, 0x08, 0x82, 0x27,
+    ILI9341_GAM3CTRL,   1, 0x00,                    /*3 gamma disable*/
+    ILI9341_GAMSET,     1, 0x01,
+    ILI9341_PGAMCTRL,   15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1, 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    ILI9341_NGAMCTRL,   15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1, 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+    ILI9341_WRDISBV,    1, 0xFF,                    /*full brightness, see LcdBacklight.c*/
+    ILI9341_BLCTRL5,    1, 0x44,                    /*dimming transition time (reset value)*/
+    ILI9341_WRCABC,     1, CABC_UI,                 /*lower the backlight on dark content*/
+    ILI9341_WRCTRLD,    1, CTRLD_BCTRL | CTRLD_DD | CTRLD_BL,
+    ILI9341_SLPOUT,     0 | LCD_SEQ_DELAY, 120,
+    ILI9341_DISPON,     0,
+    LCD_SEQ_END
+};
+
+/*MADCTL of the orientations. The module shows GRAM mirrored (upright portrait needs MX)
+ *and has a BGR colour filter.*/
+static const uint8_t rotation_madctl[] = {
+    [LCD_PANEL_ROT_0]   = MADCTL_MX | MADCTL_BGR,
+    [LCD_PANEL_ROT_90]  = MADCTL_MX | MADCTL_MY | MADCTL_MV | MADCTL_BGR,
+    [LCD_PANEL_ROT_180] = MADCTL_MY | MADCTL_BGR,
+    [LCD_PANEL_ROT_270] = MADCTL_MV | MADCTL_BGR,
+};
+
+static LcdPanel_Rotation_t rotation = LCD_PANEL_ROTATION;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LcdPanel_Init(void)
+{
+    LcdBus_Reset();
+    LcdPanel_RunSequence(init_seq);
+    LcdPanel_SetRotation(rotation);
+}
+
+void LcdPanel_RunSequence(const uint8_t * seq)
+{
+    while(seq[0] != LCD_SEQ_END) {
+        uint8_t len = seq[1] & ~LCD_SEQ_DELAY;
+        LcdBus_WriteReg(seq[0]);
+        if(len) LcdBus_WriteDataMultiple(&seq[2], len);
+        if(seq[1] & LCD_SEQ_DELAY) {
+            LcdBus_DelayMs(seq[2 + len]);
+            seq++;
+        }
+        seq += 2 + len;
+    }
+}
+
+void LcdPanel_SetMadctl(uint8_t madctl)
+{
+    LcdBus_WriteReg(ILI9341_MADCTL);
+    LcdBus_WriteData(madctl);
+}
+
+void LcdPanel_SetRotation(LcdPanel_Rotation_t rot)
+{
+    if(rot > LCD_PANEL_ROT_270) rot = LCD_PANEL_ROT_0;
+
+    /*Changing the address order in the middle of a transfer would tear the picture*/
+    LcdBus_WaitIdle();
+
+    rotation = rot;
+    LcdPanel_SetMadctl(rotation_madctl[rot]);
+}
+
+LcdPanel_Rotation_t LcdPanel_GetRotation(void)
+{
+    return rotation;
+}
+
+uint16_t LcdPanel_GetHorRes(void)
+{
+    return (rotation == LCD_PANEL_ROT_90 || rotation == LCD_PANEL_ROT_270) ? LCD_PANEL_HEIGHT : LCD_PANEL_WIDTH;
+}
+
+uint16_t LcdPanel_GetVerRes(void)
+{
+    return (rotation == LCD_PANEL_ROT_90 || rotation == LCD_PANEL_ROT_270) ? LCD_PANEL_WIDTH : LCD_PANEL_HEIGHT;
+}
+
+void LcdPanel_SetWindow(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2)
+{
+    uint8_t data[4];
+
+    /*window horizontal*/
+    data[0] = x1 >> 8;
+    data[1] = x1;
+    data[2] = x2 >> 8;
+    data[3] = x2;
+    LcdBus_WriteReg(ILI9341_CASET);
+    LcdBus_WriteDataMultiple(data, 4);
+
+    /*window vertical*/
+    data[0] = y1 >> 8;
+    data[1] = y1;
+    data[2] = y2 >> 8;
+    data[3] = y2;
+    LcdBus_WriteReg(ILI9341_PASET);
+    LcdBus_WriteDataMultiple(data, 4);
+
+    LcdBus_WriteReg(ILI9341_RAMWR);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,80 @@
+/**
+ * @file lv_port_bench.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_bench.h"
+
+#if LV_USE_DEMO_BENCHMARK
+
+#include "lv_port_disp.h"
+#include "lvgl/demos/lv_demos.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void scene_finished_cb(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_bench_start(void)
+{
+    LV_LOG("\r\nBenchmark on %dx%d, draw buffer of %d lines\r\n", (int)LV_HOR_RES, (int)LV_VER_RES,
+           (int)LV_PORT_DISP_BUF_LINES);
+
+    /*Redraw as fast as possible, not in every LV_DISP_DEF_REFR_PERIOD*/
+    lv_demo_benchmark_set_max_speed(true);
+    lv_demo_benchmark_set_finished_cb(scene_finished_cb);
+
+    lv_port_disp_clear_stats();
+    lv_demo_benchmark();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Called at the end of every scene, before the demo logs its FPS, and at the end of the benchmark
+ */
+static void scene_finished_cb(void)
+{
+    const lv_port_disp_stats_t * stats = lv_port_disp_get_stats();
+
+    if(stats->refreshes) {
+        uint32_t refr_us = stats->refr_us / stats->refreshes;
+        uint32_t flush_us = stats->flush_us / stats->refreshes;
+        /*The demo continues the line with the FPS of the scene*/
+        /*Overdraw in 1/100*/
+        uint32_t overdraw = stats->px ? (uint32_t)((uint64_t)stats->drawn_px * 100 / stats->px) : 0;
+        LV_LOG("\r\n%"LV_PRIu32" frames, per frame: render %"LV_PRIu32" us, flush %"LV_PRIu32" us, "
+               "%"LV_PRIu32" px, drawn %"LV_PRIu32".%02"LV_PRIu32"x, %"LV_PRIu32" px skipped. ",
+               stats->refreshes, refr_us - flush_us, flush_us, stats->px / stats->refreshes,
+               overdraw / 100, overdraw % 100, stats->skipped_px / stats->refreshes);
+    }
+
+    lv_port_disp_clear_stats();
+}
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
@@ -0,0 +1,394 @@
+/**
+ * @file lv_port_blend.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_blend.h"
+
+#if LV_PORT_BLEND
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The masks are read by words: byte 0 is the first pixel (little endian)*/
+#define MASK_BYTE(mask32, i)    ((lv_opa_t)((mask32) >> ((i) * 8)))
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void fill_row(lv_color_t * dest_buf, lv_color_t color, int32_t w);
+static void fill_mask(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                      const lv_opa_t * mask, lv_coord_t mask_stride);
+static void fill_mask_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h, lv_color_t color,
+                          lv_opa_t opa, const lv_opa_t * mask, lv_coord_t mask_stride);
+static void map_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                    const lv_color_t * src_buf, lv_coord_t src_stride, lv_opa_t opa);
+static void map_mask(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                     const lv_color_t * src_buf, lv_coord_t src_stride, const lv_opa_t * mask, lv_coord_t mask_stride);
+static void map_mask_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                         const lv_color_t * src_buf, lv_coord_t src_stride, lv_opa_t opa,
+                         const lv_opa_t * mask, lv_coord_t mask_stride);
+static inline uint32_t mask_scale4(uint32_t mask32, lv_opa_t opa);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_blend_ctx_init(lv_disp_drv_t * drv, lv_draw_ctx_t * draw_ctx)
+{
+    lv_draw_sw_init_ctx(drv, draw_ctx);
+    ((lv_draw_sw_ctx_t *)draw_ctx)->blend = lv_port_blend;
+}
+
+void LV_ATTRIBUTE_FAST_MEM lv_port_blend(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+
+    /*Pixels with alpha (layers), set_px_cb, masks to round and the other blend modes*/
+    if(disp->driver->set_px_cb || disp->driver->screen_transp || disp->driver->antialiasing == 0 ||
+       dsc->blend_mode != LV_BLEND_MODE_NORMAL) {
+        lv_draw_sw_blend_basic(draw_ctx, dsc);
+        return;
+    }
+
+    const lv_opa_t * mask;
+    if(dsc->mask_buf == NULL || dsc->mask_res == LV_DRAW_MASK_RES_FULL_COVER) mask = NULL;
+    else if(dsc->mask_res == LV_DRAW_MASK_RES_TRANSP) return;
+    else mask = dsc->mask_buf;
+
+    lv_area_t blend_area;
+    if(!_lv_area_intersect(&blend_area, dsc->blend_area, draw_ctx->clip_area)) return;
+
+    int32_t w = lv_area_get_width(&blend_area);
+    int32_t h = lv_area_get_height(&blend_area);
+    lv_opa_t opa = dsc->opa;
+
+    lv_coord_t dest_stride = lv_area_get_width(draw_ctx->buf_area);
+    lv_color_t * dest_buf = draw_ctx->buf;
+    dest_buf += dest_stride * (blend_area.y1 - draw_ctx->buf_area->y1) + (blend_area.x1 - draw_ctx->buf_area->x1);
+
+    lv_coord_t mask_stride = 0;
+    if(mask) {
+        mask_stride = lv_area_get_width(dsc->mask_area);
+        mask += mask_stride * (blend_area.y1 - dsc->mask_area->y1) + (blend_area.x1 - dsc->mask_area->x1);
+    }
+
+    int32_t y;
+    if(dsc->src_buf == NULL) {
+        /*The thresholds of the opacity are the ones of fill_normal() in lv_draw_sw_blend.c*/
+        if(mask == NULL && opa >= LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                fill_row(dest_buf, dsc->color, w);
+                dest_buf += dest_stride;
+            }
+        }
+        else if(mask == NULL) {
+            /*The same rounding as LVGL: lv_color_mix_premult()*/
+            lv_draw_sw_blend_basic(draw_ctx, dsc);
+        }
+        else if(opa >= LV_OPA_MAX) {
+            fill_mask(dest_buf, dest_stride, w, h, dsc->color, mask, mask_stride);
+        }
+        else {
+            fill_mask_opa(dest_buf, dest_stride, w, h, dsc->color, opa, mask, mask_stride);
+        }
+    }
+    else {
+        lv_coord_t src_stride = lv_area_get_width(dsc->blend_area);
+        const lv_color_t * src_buf = dsc->src_buf;
+        src_buf += src_stride * (blend_area.y1 - dsc->blend_area->y1) + (blend_area.x1 - dsc->blend_area->x1);
+
+        /*The thresholds of the opacity are the ones of map_normal() in lv_draw_sw_blend.c*/
+        if(mask == NULL && opa >= LV_OPA_MAX) {
+            for(y = 0; y < h; y++) {
+                lv_memcpy(dest_buf, src_buf, w * sizeof(lv_color_t));
+                dest_buf += dest_stride;
+                src_buf += src_stride;
+            }
+        }
+        else if(mask == NULL) {
+            map_opa(dest_buf, dest_stride, w, h, src_buf, src_stride, opa);
+        }
+        else if(opa > LV_OPA_MAX) {
+            map_mask(dest_buf, dest_stride, w, h, src_buf, src_stride, mask, mask_stride);
+        }
+        else {
+            map_mask_opa(dest_buf, dest_stride, w, h, src_buf, src_stride, opa, mask, mask_stride);
+        }
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Fill a row with a color. The compiler makes STRD of the 64-bit stores.
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_row(lv_color_t * dest_buf, lv_color_t color, int32_t w)
+{
+    uint32_t c32 = (uint32_t)color.full | (uint32_t)color.full << 16;
+    uint64_t c64 = (uint64_t)c32 << 32 | c32;
+
+    for(; w > 0 && ((lv_uintptr_t)dest_buf & 0x7); w--) *dest_buf++ = color;
+
+    uint64_t * d64 = (uint64_t *)dest_buf;
+    for(; w >= 8; w -= 8) {
+        d64[0] = c64;
+        d64[1] = c64;
+        d64 += 2;
+    }
+
+    dest_buf = (lv_color_t *)d64;
+    for(; w > 0; w--) *dest_buf++ = color;
+}
+
+/**
+ * Fill with a color through a mask: the edges of the anti-aliased shapes and the letters
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_mask(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                            lv_color_t color, const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    uint32_t c32 = (uint32_t)color.full | (uint32_t)color.full << 16;
+    int32_t x;
+    int32_t y;
+    int32_t i;
+
+    for(y = 0; y < h; y++) {
+        /*lv_color_mix() with a mask of 0 gives the background: skip those pixels*/
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = color;
+            else if(mask[x]) dest_buf[x] = lv_color_mix(color, dest_buf[x], mask[x]);
+        }
+
+        for(; x <= w - 4; x += 4) {
+            uint32_t mask32 = *(const uint32_t *)&mask[x];
+            if(mask32 == 0) continue;
+
+            if(mask32 == 0xFFFFFFFF) {
+                if((lv_uintptr_t)&dest_buf[x] & 0x3) {
+                    dest_buf[x] = color;
+                    *(uint32_t *)&dest_buf[x + 1] = c32;
+                    dest_buf[x + 3] = color;
+                }
+                else {
+                    *(uint32_t *)&dest_buf[x] = c32;
+                    *(uint32_t *)&dest_buf[x + 2] = c32;
+                }
+                continue;
+            }
+
+            for(i = 0; i < 4; i++) {
+                lv_opa_t m = MASK_BYTE(mask32, i);
+                if(m == LV_OPA_COVER) dest_buf[x + i] = color;
+                else if(m) dest_buf[x + i] = lv_color_mix(color, dest_buf[x + i], m);
+            }
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = color;
+            else if(mask[x]) dest_buf[x] = lv_color_mix(color, dest_buf[x], mask[x]);
+        }
+
+        dest_buf += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+/**
+ * Fill with a semi transparent color through a mask.
+ * The last result is reused as fill_normal() does: the background is often the same.
+ */
+static void LV_ATTRIBUTE_FAST_MEM fill_mask_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                                lv_color_t color, lv_opa_t opa,
+                                                const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    /*An opacity of 0 gives the background: a valid start*/
+    lv_opa_t last_opa = 0;
+    lv_color_t last_dest = dest_buf[0];
+    lv_color_t last_res = dest_buf[0];
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            uint32_t mask32;
+            lv_opa_t m;
+            lv_opa_t scaled;
+
+            if(((lv_uintptr_t)&mask[x] & 0x3) == 0 && x <= w - 4) {
+                mask32 = *(const uint32_t *)&mask[x];
+                if(mask32 == 0) {
+                    x += 3;
+                    continue;
+                }
+                /*The scaled mask of the 4 pixels*/
+                uint32_t scaled32 = mask_scale4(mask32, opa);
+                int32_t i;
+                for(i = 0; i < 4; i++) {
+                    m = MASK_BYTE(mask32, i);
+                    if(m == 0) continue;
+                    scaled = m == LV_OPA_COVER ? opa : MASK_BYTE(scaled32, i);
+                    if(scaled != last_opa || dest_buf[x + i].full != last_dest.full) {
+                        last_opa = scaled;
+                        last_dest = dest_buf[x + i];
+                        last_res = lv_color_mix(color, last_dest, scaled);
+                    }
+                    dest_buf[x + i] = last_res;
+                }
+                x += 3;
+                continue;
+            }
+
+            m = mask[x];
+            if(m == 0) continue;
+            scaled = m == LV_OPA_COVER ? opa : (lv_opa_t)(((uint32_t)m * opa) >> 8);
+            if(scaled != last_opa || dest_buf[x].full != last_dest.full) {
+                last_opa = scaled;
+                last_dest = dest_buf[x];
+                last_res = lv_color_mix(color, last_dest, scaled);
+            }
+            dest_buf[x] = last_res;
+        }
+        dest_buf += dest_stride;
+        mask += mask_stride;
+    }
+}
+
+/**
+ * Blend an image with an opacity, two pixels per iteration
+ */
+static void LV_ATTRIBUTE_FAST_MEM map_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                          const lv_color_t * src_buf, lv_coord_t src_stride, lv_opa_t opa)
+{
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w - 1; x += 2) {
+            lv_color_t d0 = lv_color_mix(src_buf[x], dest_buf[x], opa);
+            lv_color_t d1 = lv_color_mix(src_buf[x + 1], dest_buf[x + 1], opa);
+            dest_buf[x] = d0;
+            dest_buf[x + 1] = d1;
+        }
+        if(x < w) dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], opa);
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+    }
+}
+
+/**
+ * Blend an image through a mask
+ */
+static void LV_ATTRIBUTE_FAST_MEM map_mask(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                           const lv_color_t * src_buf, lv_coord_t src_stride,
+                                           const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    int32_t x;
+    int32_t y;
+    int32_t i;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = src_buf[x];
+            else if(mask[x]) dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], mask[x]);
+        }
+
+        for(; x <= w - 4; x += 4) {
+            uint32_t mask32 = *(const uint32_t *)&mask[x];
+            if(mask32 == 0) continue;
+
+            if(mask32 == 0xFFFFFFFF) {
+                lv_memcpy(&dest_buf[x], &src_buf[x], 4 * sizeof(lv_color_t));
+                continue;
+            }
+
+            for(i = 0; i < 4; i++) {
+                lv_opa_t m = MASK_BYTE(mask32, i);
+                if(m == LV_OPA_COVER) dest_buf[x + i] = src_buf[x + i];
+                else if(m) dest_buf[x + i] = lv_color_mix(src_buf[x + i], dest_buf[x + i], m);
+            }
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == LV_OPA_COVER) dest_buf[x] = src_buf[x];
+            else if(mask[x]) dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], mask[x]);
+        }
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+        mask += mask_stride;
+    }
+}
+
+/**
+ * Blend an image with an opacity through a mask
+ */
+static void LV_ATTRIBUTE_FAST_MEM map_mask_opa(lv_color_t * dest_buf, lv_coord_t dest_stride, int32_t w, int32_t h,
+                                               const lv_color_t * src_buf, lv_coord_t src_stride, lv_opa_t opa,
+                                               const lv_opa_t * mask, lv_coord_t mask_stride)
+{
+    int32_t x;
+    int32_t y;
+    int32_t i;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w && ((lv_uintptr_t)&mask[x] & 0x3); x++) {
+            if(mask[x] == 0) continue;
+            lv_opa_t scaled = mask[x] >= LV_OPA_MAX ? opa : (lv_opa_t)(((uint32_t)mask[x] * opa) >> 8);
+            dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], scaled);
+        }
+
+        for(; x <= w - 4; x += 4) {
+            uint32_t mask32 = *(const uint32_t *)&mask[x];
+            if(mask32 == 0) continue;
+
+            uint32_t scaled32 = mask_scale4(mask32, opa);
+            for(i = 0; i < 4; i++) {
+                lv_opa_t m = MASK_BYTE(mask32, i);
+                if(m == 0) continue;
+                lv_opa_t scaled = m >= LV_OPA_MAX ? opa : MASK_BYTE(scaled32, i);
+                dest_buf[x + i] = lv_color_mix(src_buf[x + i], dest_buf[x + i], scaled);
+            }
+        }
+
+        for(; x < w; x++) {
+            if(mask[x] == 0) continue;
+            lv_opa_t scaled = mask[x] >= LV_OPA_MAX ? opa : (lv_opa_t)(((uint32_t)mask[x] * opa) >> 8);
+            dest_buf[x] = lv_color_mix(src_buf[x], dest_buf[x], scaled);
+        }
+
+        dest_buf += dest_stride;
+        src_buf += src_stride;
+        mask += mask_stride;
+    }
+}
+
+/**
+ * `(mask * opa) >> 8` of the 4 bytes of a mask word. The bytes 0, 2 and 1, 3 are scaled
+ * by one multiply each: the products fit into the 16 bit halves.
+ */
+static inline uint32_t mask_scale4(uint32_t mask32, lv_opa_t opa)
+{
+    uint32_t even = (((mask32 & 0x00FF00FF) * opa) >> 8) & 0x00FF00FF;
+    uint32_t odd = (((mask32 >> 8) & 0x00FF00FF) * opa) & 0xFF00FF00;
+    return even | odd;
+}
+
+#endif /*LV_PORT_BLEND*/
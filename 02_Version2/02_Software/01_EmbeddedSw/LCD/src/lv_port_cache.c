@@ -0,0 +1,104 @@
+/**
+ * @file lv_port_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_cache.h"
+#include "lvgl.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void prewarm_grad(lv_obj_t * obj);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_port_cache_stats_t stats[_LV_PORT_CACHE_NUM];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_port_cache_count(lv_port_cache_t cache, bool hit)
+{
+    if(hit) stats[cache].hits++;
+    else stats[cache].misses++;
+}
+
+const lv_port_cache_stats_t * lv_port_cache_get_stats(lv_port_cache_t cache)
+{
+    return &stats[cache];
+}
+
+void lv_port_cache_clear_stats(void)
+{
+    lv_memset_00(stats, sizeof(stats));
+}
+
+void lv_port_cache_prewarm(lv_obj_t * obj)
+{
+    uint32_t i;
+
+    if(lv_obj_check_type(obj, &lv_img_class)) {
+        const void * src = lv_img_get_src(obj);
+        if(src && lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) {
+            lv_draw_img_dsc_t dsc;
+            lv_draw_img_dsc_init(&dsc);
+            lv_obj_init_draw_img_dsc(obj, LV_PART_MAIN, &dsc);
+            _lv_img_cache_open(src, dsc.recolor, dsc.frame_id);
+        }
+    }
+
+    prewarm_grad(obj);
+
+    for(i = 0; i < lv_obj_get_child_cnt(obj); i++) lv_port_cache_prewarm(lv_obj_get_child(obj, i));
+}
+
+void lv_port_cache_prewarm_img(const void * src)
+{
+    lv_draw_img_dsc_t dsc;
+
+    lv_draw_img_dsc_init(&dsc);
+    _lv_img_cache_open(src, dsc.recolor, dsc.frame_id);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Compute the gradient of the background as drawing it does.
+ * The indicators are left out: their size follows their value.
+ */
+static void prewarm_grad(lv_obj_t * obj)
+{
+    lv_draw_rect_dsc_t dsc;
+
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_img_opa = LV_OPA_TRANSP;
+    dsc.border_opa = LV_OPA_TRANSP;
+    dsc.outline_opa = LV_OPA_TRANSP;
+    dsc.shadow_opa = LV_OPA_TRANSP;
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &dsc);
+
+    if(dsc.bg_opa <= LV_OPA_MIN || dsc.bg_grad.dir == LV_GRAD_DIR_NONE) return;
+
+    lv_grad_t * grad = lv_gradient_get(&dsc.bg_grad, lv_obj_get_width(obj), lv_obj_get_height(obj));
+    if(grad) lv_gradient_cleanup(grad);
+}
@@ -0,0 +1,213 @@
+/**
+ * @file lv_port_disp.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_blend.h"
+#include "Perf.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#ifndef LV_PORT_DISP_BUF_ATTR
+    /*Not initialized by the startup code (NOLOAD in STM32F446RE_FLASH.ld).
+     *LcdBus_WriteData16Multiple() reads the pixels by words: keep it word aligned.*/
+    #define LV_PORT_DISP_BUF_ATTR __attribute__((section(".lvgl_draw_buf"), aligned(4)))
+#endif
+
+/*Flushes per measurement of lv_port_disp_calibrate_cost()*/
+#define CALIBRATE_RUNS  64
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void render_start_cb(lv_disp_drv_t * drv);
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
+static uint32_t area_cost_cb(lv_disp_drv_t * drv, const lv_area_t * area);
+static uint32_t bus_ns(uint32_t px);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_disp_draw_buf_t disp_buf;
+
+static LV_PORT_DISP_BUF_ATTR lv_color_t buf_1[LV_PORT_DISP_BUF_SIZE];
+#if LV_PORT_DISP_DOUBLE_BUF
+    /*LVGL renders into one while the other is flushed*/
+    static LV_PORT_DISP_BUF_ATTR lv_color_t buf_2[LV_PORT_DISP_BUF_SIZE];
+#endif
+
+static lv_disp_drv_t disp_drv;
+
+static lv_port_disp_stats_t stats;
+static uint32_t refr_start;
+
+static lv_port_disp_cost_t cost = {
+    .window_ns = LV_PORT_DISP_COST_WINDOW_NS,
+    .px_ns = LV_PORT_DISP_COST_PX_NS,
+    .stripe_ns = LV_PORT_DISP_COST_STRIPE_NS,
+    .render_px_ns = LV_PORT_DISP_COST_RENDER_PX_NS,
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_disp_t * lv_port_disp_init(void)
+{
+    ili9341_init();
+    Perf_Init();
+
+    lv_port_disp_set_buf_lines(LV_PORT_DISP_BUF_LINES, LV_PORT_DISP_DOUBLE_BUF);
+
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.draw_buf = &disp_buf;
+    disp_drv.flush_cb = flush_cb;
+    disp_drv.render_start_cb = render_start_cb;
+    disp_drv.area_cost_cb = area_cost_cb;
+#if LV_PORT_BLEND
+    disp_drv.draw_ctx_init = lv_port_blend_ctx_init;
+    disp_drv.draw_ctx_size = sizeof(lv_draw_sw_ctx_t);
+#endif
+    disp_drv.drv_update_cb = ili9341_update;
+    disp_drv.hor_res = LCD_PANEL_WIDTH;
+    disp_drv.ver_res = LCD_PANEL_HEIGHT;
+
+    /*Rotated by the panel, LVGL only swaps the resolution*/
+    disp_drv.sw_rotate = 0;
+    disp_drv.rotated = (lv_disp_rot_t)LcdPanel_GetRotation();
+
+#if LV_PORT_DISP_CALIBRATE
+    lv_port_disp_calibrate_cost();
+#endif
+
+    return lv_disp_drv_register(&disp_drv);
+}
+
+void lv_port_disp_set_buf_lines(uint32_t lines, bool double_buf)
+{
+    void * buf_2_act = NULL;
+
+    if(lines > LV_PORT_DISP_BUF_LINES) lines = LV_PORT_DISP_BUF_LINES;
+    if(lines == 0) lines = 1;
+
+#if LV_PORT_DISP_DOUBLE_BUF
+    if(double_buf) buf_2_act = buf_2;
+#else
+    LV_UNUSED(double_buf);
+#endif
+
+    lv_disp_draw_buf_init(&disp_buf, buf_1, buf_2_act, LCD_PANEL_HEIGHT * lines);
+}
+
+void lv_port_disp_set_cost(const lv_port_disp_cost_t * new_cost)
+{
+    if(new_cost) cost = *new_cost;
+    disp_drv.area_cost_cb = new_cost ? area_cost_cb : NULL;
+}
+
+const lv_port_disp_cost_t * lv_port_disp_get_cost(void)
+{
+    return disp_drv.area_cost_cb ? &cost : NULL;
+}
+
+void lv_port_disp_calibrate_cost(void)
+{
+    /*Black pixels: buf_1 is not initialized*/
+    lv_memset_00(buf_1, LCD_PANEL_WIDTH * sizeof(lv_color_t));
+
+    /*A flush of one pixel is the window setup, the rest of a row (the short side fits in any rotation)
+     *is the pixels*/
+    uint32_t window_ns = bus_ns(1);
+    uint32_t row_ns = bus_ns(LCD_PANEL_WIDTH);
+
+    cost.window_ns = window_ns;
+    cost.px_ns = row_ns > window_ns ? (row_ns - window_ns) / (LCD_PANEL_WIDTH - 1) : 0;
+}
+
+const lv_port_disp_stats_t * lv_port_disp_get_stats(void)
+{
+    return &stats;
+}
+
+void lv_port_disp_clear_stats(void)
+{
+    lv_memset_00(&stats, sizeof(stats));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void render_start_cb(lv_disp_drv_t * drv)
+{
+    LV_UNUSED(drv);
+    refr_start = Perf_Now();
+}
+
+static void flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p)
+{
+    /*ili9341_flush() reports the flush ready: check it before*/
+    bool last = lv_disp_flush_is_last(drv);
+    uint32_t start = Perf_Now();
+
+    ili9341_flush(drv, area, color_p);
+
+    stats.flush_us += Perf_ToUs(Perf_Now() - start);
+    stats.flushes++;
+    stats.px += lv_area_get_size(area);
+    if(last) {
+        /*The last stripe is rendered: the counters of the refresh are complete*/
+        const lv_refr_overdraw_t * overdraw = lv_refr_get_overdraw();
+        stats.drawn_px += overdraw->drawn_px;
+        stats.skipped_px += overdraw->skipped_px;
+        stats.refreshes++;
+        stats.refr_us += Perf_ToUs(Perf_Now() - refr_start);
+    }
+}
+
+/**
+ * Estimate the time of refreshing an area with the profile (`area_cost_cb`).
+ * LVGL renders the area in stripes of the draw buffer (`get_max_row()` of lv_refr.c).
+ */
+static uint32_t area_cost_cb(lv_disp_drv_t * drv, const lv_area_t * area)
+{
+    uint32_t w = lv_area_get_width(area);
+    uint32_t h = lv_area_get_height(area);
+    uint32_t rows = drv->draw_buf->size / w;
+
+    if(rows == 0) rows = 1;
+    uint32_t stripes = (h + rows - 1) / rows;
+
+    return stripes * (cost.window_ns + cost.stripe_ns) + w * h * (cost.px_ns + cost.render_px_ns);
+}
+
+/**
+ * Measure the time of sending the first `px` pixels of the first row of the panel
+ * @param px    the width of the window
+ * @return      [ns] the average time of a flush
+ */
+static uint32_t bus_ns(uint32_t px)
+{
+    uint32_t start = Perf_Now();
+    uint32_t i;
+
+    for(i = 0; i < CALIBRATE_RUNS; i++) {
+        LcdPanel_SetWindow(0, 0, (uint16_t)(px - 1), 0);
+        LcdBus_WriteData16Multiple((const uint16_t *)buf_1, px);
+    }
+
+    return Perf_ToUs(Perf_Now() - start) * 1000 / CALIBRATE_RUNS;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file lv_port_indev.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_indev.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void encoder_read(lv_indev_drv_t * drv, lv_indev_data_t * data);
+static void read_now(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_indev_drv_t indev_drv;
+static lv_indev_t * indev;
+static lv_group_t * group;
+static bool pressed;        /*state of the button after the last processed edge*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_indev_t * lv_port_indev_init(void)
+{
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_ENCODER;
+    indev_drv.read_cb = encoder_read;
+    indev_drv.long_press_time = LV_PORT_INDEV_LONG_PRESS_TIME;
+    indev = lv_indev_drv_register(&indev_drv);
+
+    /*Read only on input, see lv_port_indev_process()*/
+    lv_timer_pause(indev->driver->read_timer);
+
+    group = lv_group_create();
+    lv_group_set_default(group);
+    lv_indev_set_group(indev, group);
+
+    pressed = false;
+    return indev;
+}
+
+void lv_port_indev_process(void)
+{
+    bool edge = false;
+    bool state;
+
+    /*One read per edge, so a click shorter than a GUI cycle isn't lost*/
+    while(Encoder_GetButtonEvent(&state)) {
+        pressed = state;
+        read_now();
+        edge = true;
+    }
+
+    if(!edge && (pressed || Encoder_HasSteps(ENCODER_TARGET_GUI))) read_now();
+}
+
+lv_group_t * lv_port_indev_get_group(void)
+{
+    return group;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void encoder_read(lv_indev_drv_t * drv, lv_indev_data_t * data)
+{
+    LV_UNUSED(drv);
+
+    int32_t steps = Encoder_TakeSteps(ENCODER_TARGET_GUI);
+    data->enc_diff = (int16_t)LV_CLAMP(INT16_MIN, steps, INT16_MAX);
+    data->state = pressed ? LV_INDEV_STATE_PRESSED : LV_INDEV_STATE_RELEASED;
+}
+
+static void read_now(void)
+{
+    lv_indev_read_timer_cb(indev->driver->read_timer);
+}
@@ -0,0 +1,508 @@
+/**
+ * @file lv_port_mem.c
+ *
+ * The statistics count the size of the blocks (as lv_tlsf_block_size() or the FreeRTOS
+ * back end reports them), so cur_used is the memory really taken from the pool.
+ *
+ * A slab takes a page from TLSF when all of its pages are full and keeps its empty pages till
+ * TLSF runs out of memory (or lv_port_mem_trim()): starting and ending animations, timers and
+ * events reuses the same blocks without touching TLSF.
+ * Before every block of a slab there is a word with its page and bit 0 set. TLSF keeps the size
+ * of its blocks there with bit 0 (free) clear, so the word tells where a block comes from.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_mem.h"
+
+#if LV_MEM_CUSTOM_TLSF
+    #include "lvgl/src/misc/lv_tlsf.h"
+#else
+    #include "FreeRTOS.h"
+    #include "task.h"
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+#if LV_MEM_CUSTOM_TLSF && !defined(LV_PORT_MEM_POOL_ATTR)
+    /*Not initialized by the startup code (NOLOAD in STM32F446RE_FLASH.ld)*/
+    #define LV_PORT_MEM_POOL_ATTR __attribute__((section(".lvgl_pool"), aligned(8)))
+#endif
+
+#if LV_PORT_MEM_SLAB
+    #define SLAB_TAG        ((uintptr_t)1)      /*bit 0 of the word before the blocks*/
+    #define SLAB_MAX_WORDS  64                  /*the largest allocation of the slabs in words*/
+    #define NO_SLAB         0xFF
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+#if !LV_MEM_CUSTOM_TLSF
+/*Put before the allocations from the FreeRTOS heap: heap_4 doesn't tell the size of a block*/
+typedef union {
+    size_t size;
+    uint64_t align;
+} block_header_t;
+#endif
+
+#if LV_PORT_MEM_SLAB
+/*At the start of the pages of the slabs*/
+typedef struct _slab_page_t {
+    struct _slab_page_t * prev;     /*in the list of the pages with free blocks*/
+    struct _slab_page_t * next;
+    void * free;                    /*free blocks, linked by their first word*/
+    uint16_t used;
+    uint8_t slab;
+} slab_page_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void init(void);
+static size_t block_size(void * p);
+static void count_alloc(size_t size);
+static void count_free(size_t size);
+static uint32_t size_class(size_t size);
+#if LV_MEM_CUSTOM_TLSF
+    static void walker(void * ptr, size_t size, int used, void * user);
+#endif
+#if LV_PORT_MEM_SLAB
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static void slab_free(void * p);
+    static slab_page_t * page_add(uint32_t slab);
+    static void page_link(slab_page_t * page);
+    static void page_unlink(slab_page_t * page);
+    static slab_page_t * slab_page(const void * p);
+    static void * tlsf_malloc(size_t size);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+#if LV_MEM_CUSTOM_TLSF
+    static LV_PORT_MEM_POOL_ATTR uint8_t pool[LV_MEM_SIZE];
+    static lv_tlsf_t tlsf;
+#endif
+
+static lv_port_mem_stats_t stats;
+
+#if LV_PORT_MEM_SLAB
+    static slab_page_t * partial[LV_PORT_MEM_SLAB_NUM];     /*the pages with free blocks per slab*/
+    static uint8_t slab_of_size[SLAB_MAX_WORDS + 1];        /*the slab by the size in words or NO_SLAB*/
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void * lv_port_mem_alloc(size_t size)
+{
+    void * p;
+
+    init();
+
+#if LV_PORT_MEM_SLAB
+    p = slab_alloc(size);
+    if(p == NULL) p = tlsf_malloc(size);
+#elif LV_MEM_CUSTOM_TLSF
+    p = lv_tlsf_malloc(tlsf, size);
+#else
+    block_header_t * header = pvPortMalloc(sizeof(block_header_t) + size);
+    if(header) header->size = sizeof(block_header_t) + size;
+    p = header ? header + 1 : NULL;
+#endif
+
+    if(p == NULL) {
+        stats.fails++;
+        return NULL;
+    }
+
+    count_alloc(block_size(p));
+    return p;
+}
+
+void lv_port_mem_free(void * p)
+{
+    if(p == NULL) return;
+
+    count_free(block_size(p));
+
+#if LV_PORT_MEM_SLAB
+    if(slab_page(p)) slab_free(p);
+    else lv_tlsf_free(tlsf, p);
+#elif LV_MEM_CUSTOM_TLSF
+    lv_tlsf_free(tlsf, p);
+#else
+    vPortFree((block_header_t *)p - 1);
+#endif
+}
+
+void * lv_port_mem_realloc(void * p, size_t size)
+{
+    if(p == NULL) return lv_port_mem_alloc(size);
+
+    size_t old_size = block_size(p);
+
+#if LV_PORT_MEM_SLAB
+    if(slab_page(p)) {
+        /*Fits (the block has the word of the page too): stays, else moved to a larger slab or to TLSF*/
+        if(size <= old_size - sizeof(uintptr_t)) return p;
+        void * new_p = lv_port_mem_alloc(size);
+        if(new_p == NULL) return NULL;
+        lv_memcpy(new_p, p, old_size - sizeof(uintptr_t));
+        lv_port_mem_free(p);
+        return new_p;
+    }
+#endif
+
+#if LV_MEM_CUSTOM_TLSF
+    void * new_p = lv_tlsf_realloc(tlsf, p, size);
+#if LV_PORT_MEM_SLAB
+    if(new_p == NULL && size > 0 && lv_port_mem_trim()) new_p = lv_tlsf_realloc(tlsf, p, size);
+#endif
+    if(new_p == NULL) {
+        stats.fails++;
+        return NULL;
+    }
+    count_free(old_size);
+    count_alloc(block_size(new_p));
+#else
+    /*heap_4 can't resize in place*/
+    void * new_p = lv_port_mem_alloc(size);
+    if(new_p == NULL) return NULL;
+    lv_memcpy(new_p, p, LV_MIN(size, old_size - sizeof(block_header_t)));
+    lv_port_mem_free(p);
+#endif
+
+    return new_p;
+}
+
+void lv_port_mem_monitor(lv_mem_monitor_t * mon_p)
+{
+    lv_port_mem_report_t report;
+
+    lv_port_mem_report(&report);
+
+    lv_memset_00(mon_p, sizeof(lv_mem_monitor_t));
+    mon_p->total_size = report.total_size;
+    mon_p->free_cnt = report.free_cnt;
+    mon_p->free_size = report.free_size + report.slab_free_size;
+    mon_p->free_biggest_size = report.free_biggest_size;
+    mon_p->used_cnt = report.used_cnt;
+    mon_p->max_used = stats.max_used;
+    mon_p->used_pct = 100 - (100U * mon_p->free_size) / report.total_size;
+    mon_p->frag_pct = report.frag_pct;
+}
+
+void lv_port_mem_report(lv_port_mem_report_t * report)
+{
+    init();
+
+    lv_memset_00(report, sizeof(lv_port_mem_report_t));
+
+#if LV_MEM_CUSTOM_TLSF
+    report->total_size = LV_MEM_SIZE;
+    lv_tlsf_walk_pool(lv_tlsf_get_pool(tlsf), walker, report);
+#if LV_PORT_MEM_SLAB
+    /*The pages are used blocks of TLSF: count their blocks instead*/
+    uint32_t i;
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        const lv_port_mem_slab_t * slab = &stats.slabs[i];
+        uint32_t blocks = slab->pages * LV_PORT_MEM_SLAB_PAGE_BLOCKS;
+        report->used_cnt += slab->used - slab->pages;
+        report->slab_free_size += (blocks - slab->used) * slab->size;
+    }
+#endif
+#else
+    /*heap_4 can't be walked: only the summary of the free blocks is known*/
+    HeapStats_t heap;
+    vPortGetHeapStats(&heap);
+    report->total_size = configTOTAL_HEAP_SIZE;
+    report->free_size = heap.xAvailableHeapSpaceInBytes;
+    report->free_biggest_size = heap.xSizeOfLargestFreeBlockInBytes;
+    report->free_cnt = heap.xNumberOfFreeBlocks;
+    uint32_t i;
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) report->used_cnt += stats.classes[i].used;
+#endif
+
+    if(report->free_size > 0) {
+        report->frag_pct = 100 - (uint8_t)(report->free_biggest_size * 100U / report->free_size);
+    }
+}
+
+#if LV_PORT_MEM_SLAB
+uint32_t lv_port_mem_trim(void)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        slab_page_t * page = partial[i];
+        while(page) {
+            slab_page_t * next = page->next;
+            if(page->used == 0) {
+                page_unlink(page);
+                lv_tlsf_free(tlsf, page);
+                stats.slabs[i].pages--;
+                cnt++;
+            }
+            page = next;
+        }
+    }
+
+    return cnt;
+}
+#endif
+
+const lv_port_mem_stats_t * lv_port_mem_get_stats(void)
+{
+    return &stats;
+}
+
+void lv_port_mem_clear_stats(void)
+{
+    uint32_t i;
+
+    stats.max_used = stats.cur_used;
+    stats.fails = 0;
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) {
+        stats.classes[i].allocs = 0;
+        stats.classes[i].peak = stats.classes[i].used;
+    }
+#if LV_PORT_MEM_SLAB
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        stats.slabs[i].allocs = 0;
+        stats.slabs[i].page_allocs = 0;
+        stats.slabs[i].fallbacks = 0;
+        stats.slabs[i].peak = stats.slabs[i].used;
+    }
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Create the pool at the first allocation: lv_mem_init() does nothing with LV_MEM_CUSTOM
+ */
+static void init(void)
+{
+#if LV_MEM_CUSTOM_TLSF
+    if(tlsf == NULL) {
+        tlsf = lv_tlsf_create_with_pool(pool, sizeof(pool));
+#if LV_PORT_MEM_SLAB
+        slab_init();
+#endif
+    }
+#endif
+}
+
+static size_t block_size(void * p)
+{
+#if LV_PORT_MEM_SLAB
+    slab_page_t * page = slab_page(p);
+    if(page) return stats.slabs[page->slab].size;
+#endif
+#if LV_MEM_CUSTOM_TLSF
+    return lv_tlsf_block_size(p);
+#else
+    return ((block_header_t *)p - 1)->size;
+#endif
+}
+
+static void count_alloc(size_t size)
+{
+    lv_port_mem_class_t * c = &stats.classes[size_class(size)];
+
+    c->allocs++;
+    c->used++;
+    if(c->used > c->peak) c->peak = c->used;
+
+    stats.cur_used += size;
+    if(stats.cur_used > stats.max_used) stats.max_used = stats.cur_used;
+}
+
+static void count_free(size_t size)
+{
+    stats.classes[size_class(size)].used--;
+    stats.cur_used -= size;
+}
+
+/**
+ * Get the index of the smallest class holding `size`
+ */
+static uint32_t size_class(size_t size)
+{
+    uint32_t i = 0;
+    size_t limit = LV_PORT_MEM_CLASS_MIN;
+
+    while(size > limit && i < LV_PORT_MEM_CLASS_NUM - 1) {
+        limit <<= 1;
+        i++;
+    }
+    return i;
+}
+
+#if LV_MEM_CUSTOM_TLSF
+static void walker(void * ptr, size_t size, int used, void * user)
+{
+    LV_UNUSED(ptr);
+
+    lv_port_mem_report_t * report = user;
+    if(used) {
+        report->used_cnt++;
+    }
+    else {
+        report->free_cnt++;
+        report->free_size += size;
+        report->free_blocks[size_class(size)]++;
+        if(size > report->free_biggest_size) report->free_biggest_size = size;
+    }
+}
+#endif
+
+#if LV_PORT_MEM_SLAB
+/**
+ * Set the sizes of the slabs and the slab of the allocations
+ */
+static void slab_init(void)
+{
+    static const size_t sizes[LV_PORT_MEM_SLAB_NUM] = LV_PORT_MEM_SLAB_SIZES;
+    uint32_t i;
+
+    lv_memset(slab_of_size, NO_SLAB, sizeof(slab_of_size));
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        uint32_t words = (sizes[i] + sizeof(void *) - 1) / sizeof(void *);
+        LV_ASSERT(words <= SLAB_MAX_WORDS);
+        /*With the word of the page*/
+        stats.slabs[i].size = (words + 1) * sizeof(void *);
+        /*The same size twice: the first serves it*/
+        if(slab_of_size[words] == NO_SLAB) slab_of_size[words] = (uint8_t)i;
+    }
+}
+
+/**
+ * Take a block from the slab of `size`
+ * @return  the block or NULL: no slab for the size or TLSF has no page for the slab
+ */
+static void * slab_alloc(size_t size)
+{
+    size_t words = (size + sizeof(void *) - 1) / sizeof(void *);
+    if(words > SLAB_MAX_WORDS || slab_of_size[words] == NO_SLAB) return NULL;
+
+    uint32_t i = slab_of_size[words];
+    lv_port_mem_slab_t * slab = &stats.slabs[i];
+    slab_page_t * page = partial[i];
+
+    if(page == NULL) {
+        page = page_add(i);
+        if(page == NULL) {
+            slab->fallbacks++;
+            return NULL;
+        }
+    }
+
+    void * p = page->free;
+    page->free = *(void **)p;
+    page->used++;
+    if(page->free == NULL) page_unlink(page);
+
+    slab->allocs++;
+    slab->used++;
+    if(slab->used > slab->peak) slab->peak = slab->used;
+    return p;
+}
+
+static void slab_free(void * p)
+{
+    slab_page_t * page = slab_page(p);
+    uint32_t i = page->slab;
+
+    /*Was full*/
+    if(page->free == NULL) page_link(page);
+
+    /*Kept even if empty: not taken and given back for every animation*/
+    *(void **)p = page->free;
+    page->free = p;
+    page->used--;
+    stats.slabs[i].used--;
+}
+
+/**
+ * Take a page from TLSF for a slab, cut it to LV_PORT_MEM_SLAB_PAGE_BLOCKS free blocks
+ * @return  the page or NULL: no memory
+ */
+static slab_page_t * page_add(uint32_t slab)
+{
+    uint32_t size = stats.slabs[slab].size;
+    slab_page_t * page = tlsf_malloc(sizeof(slab_page_t) + LV_PORT_MEM_SLAB_PAGE_BLOCKS * size);
+    if(page == NULL) return NULL;
+
+    uint8_t * block = (uint8_t *)(page + 1) + (LV_PORT_MEM_SLAB_PAGE_BLOCKS - 1) * size;
+
+    page->free = NULL;
+    page->used = 0;
+    page->slab = (uint8_t)slab;
+    /*From the end: the first blocks are used first*/
+    for(; block >= (uint8_t *)(page + 1); block -= size) {
+        *(uintptr_t *)block = (uintptr_t)page | SLAB_TAG;
+        *(void **)(block + sizeof(uintptr_t)) = page->free;
+        page->free = block + sizeof(uintptr_t);
+    }
+
+    page_link(page);
+    stats.slabs[slab].pages++;
+    stats.slabs[slab].page_allocs++;
+    return page;
+}
+
+static void page_link(slab_page_t * page)
+{
+    page->prev = NULL;
+    page->next = partial[page->slab];
+    if(page->next) page->next->prev = page;
+    partial[page->slab] = page;
+}
+
+static void page_unlink(slab_page_t * page)
+{
+    if(page->prev) page->prev->next = page->next;
+    else partial[page->slab] = page->next;
+    if(page->next) page->next->prev = page->prev;
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+/**
+ * Get the page of a block from the word before it
+ * @return  the page or NULL: the block is from TLSF
+ */
+static slab_page_t * slab_page(const void * p)
+{
+    uintptr_t tag = ((const uintptr_t *)p)[-1];
+
+    if((tag & SLAB_TAG) == 0) return NULL;
+    return (slab_page_t *)(tag & ~SLAB_TAG);
+}
+
+/**
+ * Allocate from TLSF, give the empty pages of the slabs back if it's needed
+ */
+static void * tlsf_malloc(size_t size)
+{
+    void * p = lv_tlsf_malloc(tlsf, size);
+    if(p == NULL && lv_port_mem_trim()) p = lv_tlsf_malloc(tlsf, size);
+    return p;
+}
+#endif
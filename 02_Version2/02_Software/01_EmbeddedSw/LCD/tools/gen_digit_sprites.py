@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""
+Generate the 7 segment digit sprites of the temperature readouts.
+
+The digits are rasterized here with 4x4 supersampling and stored as ready
+RGB565 pixels on black, so the GUI only copies rectangles at run time.
+
+    python3 LCD/tools/gen_digit_sprites.py            # rewrite LCD/inc/DigitSprites.h and LCD/src/DigitSprites.c
+    python3 LCD/tools/gen_digit_sprites.py --check    # fail if the committed files are out of date
+"""
+
+import argparse
+import os
+import sys
+
+WIDTH = 32          # sprite size in px
+HEIGHT = 52
+THICKNESS = 6       # segment thickness
+GAP = 1             # gap between the segments
+MARGIN_X = 2
+MARGIN_Y = 1
+SUPERSAMPLE = 4
+
+# name, 0xRRGGBB
+COLORS = [
+    ("WHITE", 0xFFFFFF),    # setpoint
+    ("RED", 0xFF0000),      # tip temperature
+]
+
+#    a
+#  f   b
+#    g
+#  e   c
+#    d
+SEGMENTS = {
+    0: "abcdef", 1: "bc", 2: "abdeg", 3: "abcdg", 4: "bcfg",
+    5: "acdfg", 6: "acdefg", 7: "abc", 8: "abcdefg", 9: "abcdfg",
+}
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."))
+OUT_H = os.path.join(ROOT, "inc", "DigitSprites.h")
+OUT_C = os.path.join(ROOT, "src", "DigitSprites.c")
+
+
+def hseg(xl, xr, yc, h):
+    return [(xl, yc), (xl + h, yc - h), (xr - h, yc - h), (xr, yc), (xr - h, yc + h), (xl + h, yc + h)]
+
+
+def vseg(xc, yt, yb, h):
+    return [(xc, yt), (xc + h, yt + h), (xc + h, yb - h), (xc, yb), (xc - h, yb - h), (xc - h, yt + h)]
+
+
+def segment_polygons():
+    h = THICKNESS / 2
+    x0, x1 = MARGIN_X, WIDTH - MARGIN_X
+    y0, y1 = MARGIN_Y, HEIGHT - MARGIN_Y
+    ya, yg, yd = y0 + h, (y0 + y1) / 2, y1 - h
+    xf, xb = x0 + h, x1 - h
+    return {
+        "a": hseg(xf + GAP, xb - GAP, ya, h),
+        "g": hseg(xf + GAP, xb - GAP, yg, h),
+        "d": hseg(xf + GAP, xb - GAP, yd, h),
+        "f": vseg(xf, ya + GAP, yg - GAP, h),
+        "b": vseg(xb, ya + GAP, yg - GAP, h),
+        "e": vseg(xf, yg + GAP, yd - GAP, h),
+        "c": vseg(xb, yg + GAP, yd - GAP, h),
+    }
+
+
+def inside(poly, x, y):
+    """Even-odd rule"""
+    res = False
+    j = len(poly) - 1
+    for i in range(len(poly)):
+        xi, yi = poly[i]
+        xj, yj = poly[j]
+        if (yi > y) != (yj > y) and x < (xj - xi) * (y - yi) / (yj - yi) + xi:
+            res = not res
+        j = i
+    return res
+
+
+def coverage(digit):
+    polys = [p for s, p in segment_polygons().items() if s in SEGMENTS[digit]]
+    cov = []
+    n = SUPERSAMPLE
+    for y in range(HEIGHT):
+        for x in range(WIDTH):
+            hit = 0
+            for sy in range(n):
+                for sx in range(n):
+                    px = x + (sx + 0.5) / n
+                    py = y + (sy + 0.5) / n
+                    if any(inside(p, px, py) for p in polys):
+                        hit += 1
+            cov.append(hit / (n * n))
+    return cov
+
+
+def rgb565(color, a):
+    r = round(((color >> 16) & 0xFF) * a)
+    g = round(((color >> 8) & 0xFF) * a)
+    b = round((color & 0xFF) * a)
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def gen_h():
+    colors = "\n".join("    DIGIT_SPRITE_%s," % name for name, _ in COLORS)
+    return f"""/**
+ * @file DigitSprites.h
+ *
+ * 7 segment digit sprites in RGB565 on black.
+ * Generated by LCD/tools/gen_digit_sprites.py, don't edit.
+ *
+ */
+
+#ifndef DIGITSPRITES_H
+#define DIGITSPRITES_H
+
+#ifdef __cplusplus
+extern "C" {{
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define DIGIT_SPRITE_W      {WIDTH}
+#define DIGIT_SPRITE_H      {HEIGHT}
+
+/*Store the pixels high byte first (for LVGL with LV_COLOR_16_SWAP 1).
+ *Define it for the whole project, DigitSprites.c doesn't see lv_conf.h*/
+#ifndef DIGIT_SPRITES_16_SWAP
+#define DIGIT_SPRITES_16_SWAP 0
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {{
+{colors}
+    _DIGIT_SPRITE_COLOR_NUM
+}} DigitSprite_Color_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+extern const uint16_t DigitSprites[_DIGIT_SPRITE_COLOR_NUM][10][DIGIT_SPRITE_W * DIGIT_SPRITE_H];
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+}} /* extern "C" */
+#endif
+
+#endif /* DIGITSPRITES_H */
+"""
+
+
+def gen_c():
+    out = []
+    out.append("""/**
+ * @file DigitSprites.c
+ *
+ * Generated by LCD/tools/gen_digit_sprites.py, don't edit.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "DigitSprites.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#if DIGIT_SPRITES_16_SWAP
+#define PX(c)   ((uint16_t)(((c) >> 8) | (((c) & 0xFF) << 8)))
+#else
+#define PX(c)   (c)
+#endif
+
+/**********************
+ *   GLOBAL VARIABLES
+ **********************/
+const uint16_t DigitSprites[_DIGIT_SPRITE_COLOR_NUM][10][DIGIT_SPRITE_W * DIGIT_SPRITE_H] = {""")
+    covs = [coverage(d) for d in range(10)]
+    for name, color in COLORS:
+        out.append("    [DIGIT_SPRITE_%s] = {" % name)
+        for d in range(10):
+            out.append("        /*%d*/ {" % d)
+            px = [rgb565(color, a) for a in covs[d]]
+            for y in range(HEIGHT):
+                row = px[y * WIDTH:(y + 1) * WIDTH]
+                out.append("            " + ", ".join("PX(0x%04X)" % p for p in row) + ",")
+            out.append("        },")
+        out.append("    },")
+    out.append("};")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--check", action="store_true", help="compare with the files instead of writing them")
+    args = parser.parse_args()
+
+    files = {OUT_H: gen_h(), OUT_C: gen_c()}
+    if args.check:
+        stale = [p for p, txt in files.items() if not os.path.exists(p) or open(p).read() != txt]
+        for p in stale:
+            print("%s is out of date, run %s" % (p, os.path.relpath(__file__, os.path.dirname(ROOT))))
+        return 1 if stale else 0
+
+    for p, txt in files.items():
+        with open(p, "w") as f:
+            f.write(txt)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,102 @@
+/**
+ * @file LcdBusHost.c
+ *
+ * LcdBus implementation of the host tests: the bytes go to the ILI9341 model (LcdEmu)
+ * instead of GPIOB.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdBus.h"
+#include "LcdEmu.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LcdBus_Init(void)
+{
+}
+
+void LcdBus_Reset(void)
+{
+    LcdEmu_Reset();
+}
+
+void LcdBus_DelayMs(uint32_t ms)
+{
+    LcdEmu_Delay(ms);
+}
+
+void LcdBus_WriteReg(uint8_t cmd)
+{
+    LcdEmu_WriteCommand(cmd);
+}
+
+void LcdBus_WriteData(uint8_t data)
+{
+    LcdEmu_WriteData(data);
+}
+
+void LcdBus_WriteDataMultiple(const uint8_t * pData, uint32_t NumItems)
+{
+    while(NumItems--) LcdEmu_WriteData(*pData++);
+}
+
+void LcdBus_WriteData16Multiple(const uint16_t * pData, uint32_t NumItems)
+{
+    while(NumItems--) {
+        LcdEmu_WriteData((uint8_t)(*pData >> 8));
+        LcdEmu_WriteData((uint8_t)*pData);
+        pData++;
+    }
+}
+
+/*The asynchronous writes complete before returning, like the GPIO bus of the board*/
+void LcdBus_WriteDataMultipleAsync(const uint8_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb, void * user_data)
+{
+    LcdBus_WriteDataMultiple(pData, NumItems);
+    if(cb) cb(user_data);
+}
+
+void LcdBus_WriteData16MultipleAsync(const uint16_t * pData, uint32_t NumItems, LcdBus_DoneCb_t cb,
+                                     void * user_data)
+{
+    LcdBus_WriteData16Multiple(pData, NumItems);
+    if(cb) cb(user_data);
+}
+
+bool LcdBus_IsBusy(void)
+{
+    return false;
+}
+
+void LcdBus_WaitIdle(void)
+{
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
@@ -0,0 +1,384 @@
+/**
+ * @file LcdEmu.c
+ *
+ * The GRAM address of a pixel is computed like in the ILI9341 (see 8.2.29 of the datasheet):
+ * the column/page counters run in the CASET/PASET window, MV exchanges them,
+ * MX and MY mirror the result.
+ * The module is mounted mirrored: the viewer sees GRAM column 239 on the left,
+ * so MADCTL = MX is the upright portrait picture. Its colour filter is BGR.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdEmu.h"
+#include "LcdPanel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <png.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void sw_reset(void);
+static void param_done(void);
+static void pixel_write(uint16_t c);
+static void view_to_gram(LcdEmu_View_t view, uint32_t x, uint32_t y, uint32_t * gx, uint32_t * gy);
+static void view_size(LcdEmu_View_t view, uint32_t * w, uint32_t * h);
+static void render_rgb888(LcdEmu_View_t view, uint8_t * rgb);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t gram[LCD_EMU_HEIGHT][LCD_EMU_WIDTH];
+static uint8_t params[256][LCD_EMU_PARAM_MAX];
+static LcdEmu_Stats_t stats;
+
+static uint8_t cmd_act;
+static uint32_t param_cnt;
+
+static bool sleep_in;
+static bool disp_on;
+static uint8_t madctl;
+
+static uint16_t col_start, col_end, page_start, page_end;
+static uint16_t col_act, page_act;
+static bool window_full;
+static uint8_t pixel_hi;
+static bool pixel_hi_valid;
+
+/**********************
+ *      MACROS
+ **********************/
+#define SWAP_RB(c) ((uint16_t)((((c) & 0x001F) << 11) | ((c) & 0x07E0) | (((c) & 0xF800) >> 11)))
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void LcdEmu_Reset(void)
+{
+    memset(gram, 0, sizeof(gram));
+    memset(params, 0, sizeof(params));
+    sw_reset();
+}
+
+void LcdEmu_WriteCommand(uint8_t cmd)
+{
+    stats.commands++;
+
+    /*Any command terminates the memory write*/
+    cmd_act = cmd;
+    param_cnt = 0;
+    pixel_hi_valid = false;
+
+    switch(cmd) {
+        case ILI9341_SWRESET:
+            sw_reset();
+            break;
+        case ILI9341_SLPIN:
+            sleep_in = true;
+            break;
+        case ILI9341_SLPOUT:
+            sleep_in = false;
+            break;
+        case ILI9341_DISPOFF:
+            disp_on = false;
+            break;
+        case ILI9341_DISPON:
+            disp_on = true;
+            break;
+        case ILI9341_RAMWR:
+            stats.windows++;
+            col_act = col_start;
+            page_act = page_start;
+            window_full = false;
+            break;
+        case ILI9341_WRMEMCONT:
+            stats.windows++;
+            break;
+        default:
+            break;
+    }
+}
+
+void LcdEmu_WriteData(uint8_t data)
+{
+    stats.data_bytes++;
+
+    if(cmd_act == ILI9341_RAMWR || cmd_act == ILI9341_WRMEMCONT) {
+        /*16 bit pixels, high byte first*/
+        if(pixel_hi_valid == false) {
+            pixel_hi = data;
+            pixel_hi_valid = true;
+        }
+        else {
+            pixel_write((uint16_t)((pixel_hi << 8) | data));
+            pixel_hi_valid = false;
+        }
+        return;
+    }
+
+    if(param_cnt < LCD_EMU_PARAM_MAX) params[cmd_act][param_cnt] = data;
+    param_cnt++;
+    param_done();
+}
+
+void LcdEmu_Delay(uint32_t ms)
+{
+    stats.delay_ms += ms;
+}
+
+uint16_t LcdEmu_GetPixel(LcdEmu_View_t view, uint32_t x, uint32_t y)
+{
+    uint32_t gx;
+    uint32_t gy;
+
+    if(!LcdEmu_IsDisplayOn()) return 0;
+
+    view_to_gram(view, x, y, &gx, &gy);
+    return gram[gy][gx];
+}
+
+uint8_t LcdEmu_GetParam(uint8_t cmd, uint32_t idx)
+{
+    if(idx >= LCD_EMU_PARAM_MAX) return 0;
+    return params[cmd][idx];
+}
+
+bool LcdEmu_IsDisplayOn(void)
+{
+    return disp_on && !sleep_in;
+}
+
+const LcdEmu_Stats_t * LcdEmu_GetStats(void)
+{
+    return &stats;
+}
+
+void LcdEmu_ClearStats(void)
+{
+    memset(&stats, 0, sizeof(stats));
+}
+
+bool LcdEmu_WritePng(LcdEmu_View_t view, const char * path)
+{
+    png_image img;
+    uint32_t w;
+    uint32_t h;
+
+    view_size(view, &w, &h);
+    uint8_t * rgb = malloc(w * h * 3);
+    if(rgb == NULL) return false;
+    render_rgb888(view, rgb);
+
+    memset(&img, 0, sizeof(img));
+    img.version = PNG_IMAGE_VERSION;
+    img.width = w;
+    img.height = h;
+    img.format = PNG_FORMAT_RGB;
+
+    bool ok = png_image_write_to_file(&img, path, 0, rgb, 0, NULL) != 0;
+    free(rgb);
+    return ok;
+}
+
+int32_t LcdEmu_ComparePng(LcdEmu_View_t view, const char * path)
+{
+    if(getenv("UPDATE_REF_IMGS")) {
+        printf("Reference image updated: %s\n", path);
+        return LcdEmu_WritePng(view, path) ? 0 : -1;
+    }
+
+    png_image img;
+    memset(&img, 0, sizeof(img));
+    img.version = PNG_IMAGE_VERSION;
+    if(png_image_begin_read_from_file(&img, path) == 0) {
+        printf("Can't read the reference image %s: %s\n", path, img.message);
+        return -1;
+    }
+    img.format = PNG_FORMAT_RGB;
+
+    uint32_t w;
+    uint32_t h;
+    view_size(view, &w, &h);
+
+    uint8_t * ref = malloc(PNG_IMAGE_SIZE(img));
+    uint8_t * act = malloc(w * h * 3);
+    if(ref == NULL || act == NULL || png_image_finish_read(&img, NULL, ref, 0, NULL) == 0) {
+        png_image_free(&img);
+        free(ref);
+        free(act);
+        return -1;
+    }
+    render_rgb888(view, act);
+
+    int32_t diff = 0;
+    if(img.width != w || img.height != h) {
+        printf("Size mismatch: %s is %ux%u, the picture is %ux%u\n", path, (unsigned)img.width, (unsigned)img.height,
+               (unsigned)w, (unsigned)h);
+        diff = (int32_t)(w * h);
+    }
+    else {
+        uint32_t i;
+        for(i = 0; i < w * h; i++) {
+            if(memcmp(&ref[i * 3], &act[i * 3], 3)) diff++;
+        }
+    }
+
+    if(diff) {
+        /*Save the actual picture to see what has changed*/
+        char fn_err[256];
+        const char * base = strrchr(path, '/');
+        base = base ? base + 1 : path;
+        snprintf(fn_err, sizeof(fn_err), "%.*s_err.png", (int)(strcspn(base, ".")), base);
+        LcdEmu_WritePng(view, fn_err);
+        printf("%d pixels differ from %s, the picture is saved as %s\n", (int)diff, path, fn_err);
+    }
+
+    free(ref);
+    free(act);
+    return diff;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void sw_reset(void)
+{
+    /*Register defaults after reset, GRAM is kept*/
+    cmd_act = ILI9341_NOP;
+    param_cnt = 0;
+    sleep_in = true;
+    disp_on = false;
+    madctl = 0;
+    col_start = 0;
+    col_end = LCD_EMU_WIDTH - 1;
+    page_start = 0;
+    page_end = LCD_EMU_HEIGHT - 1;
+    col_act = 0;
+    page_act = 0;
+    window_full = false;
+    pixel_hi_valid = false;
+}
+
+/**
+ * Apply a command when all of its parameters have arrived
+ */
+static void param_done(void)
+{
+    const uint8_t * p = params[cmd_act];
+
+    switch(cmd_act) {
+        case ILI9341_CASET:
+            if(param_cnt == 4) {
+                col_start = (uint16_t)((p[0] << 8) | p[1]);
+                col_end = (uint16_t)((p[2] << 8) | p[3]);
+            }
+            break;
+        case ILI9341_PASET:
+            if(param_cnt == 4) {
+                page_start = (uint16_t)((p[0] << 8) | p[1]);
+                page_end = (uint16_t)((p[2] << 8) | p[3]);
+            }
+            break;
+        case ILI9341_MADCTL:
+            if(param_cnt == 1) madctl = p[0];
+            break;
+        default:
+            break;
+    }
+}
+
+static void pixel_write(uint16_t c)
+{
+    if(window_full) {
+        stats.overrun++;
+        return;
+    }
+
+    uint32_t x;
+    uint32_t y;
+    if(madctl & MADCTL_MV) {
+        x = page_act;
+        y = col_act;
+    }
+    else {
+        x = col_act;
+        y = page_act;
+    }
+    if(madctl & MADCTL_MX) x = LCD_EMU_WIDTH - 1 - x;
+    if(madctl & MADCTL_MY) y = LCD_EMU_HEIGHT - 1 - y;
+
+    /*The filter of the module is BGR: without the BGR bit red and blue are exchanged*/
+    if(x < LCD_EMU_WIDTH && y < LCD_EMU_HEIGHT) {
+        gram[y][x] = (madctl & MADCTL_BGR) ? c : SWAP_RB(c);
+        stats.pixels++;
+    }
+
+    if(col_act < col_end) {
+        col_act++;
+    }
+    else {
+        col_act = col_start;
+        if(page_act < page_end) page_act++;
+        else window_full = true;
+    }
+}
+
+static void view_to_gram(LcdEmu_View_t view, uint32_t x, uint32_t y, uint32_t * gx, uint32_t * gy)
+{
+    if(view == LCD_EMU_VIEW_LANDSCAPE) {
+        /*The portrait view turned by 90 degrees*/
+        *gx = y;
+        *gy = x;
+    }
+    else {
+        *gx = LCD_EMU_WIDTH - 1 - x;
+        *gy = y;
+    }
+}
+
+static void view_size(LcdEmu_View_t view, uint32_t * w, uint32_t * h)
+{
+    if(view == LCD_EMU_VIEW_LANDSCAPE) {
+        *w = LCD_EMU_HEIGHT;
+        *h = LCD_EMU_WIDTH;
+    }
+    else {
+        *w = LCD_EMU_WIDTH;
+        *h = LCD_EMU_HEIGHT;
+    }
+}
+
+static void render_rgb888(LcdEmu_View_t view, uint8_t * rgb)
+{
+    uint32_t w;
+    uint32_t h;
+    uint32_t x;
+    uint32_t y;
+
+    view_size(view, &w, &h);
+    for(y = 0; y < h; y++) {
+        for(x = 0; x < w; x++) {
+            uint16_t c = LcdEmu_GetPixel(view, x, y);
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >> 5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            *rgb++ = (uint8_t)((r << 3) | (r >> 2));
+            *rgb++ = (uint8_t)((g << 2) | (g >> 4));
+            *rgb++ = (uint8_t)((b << 3) | (b >> 2));
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file LcdEmu.h
+ *
+ * Host model of the ILI9341 controller and of the module it is mounted on.
+ * It decodes the command/data stream coming from LcdBus and renders GRAM into memory.
+ *
+ * Modelled: SWRESET, SLPIN/SLPOUT, DISPON/DISPOFF, CASET, PASET, RAMWR, WRMEMCONT,
+ * MADCTL (MY, MX, MV, BGR) and PIXSET. The parameters of the other commands are stored only.
+ *
+ */
+
+#ifndef LCDEMU_H
+#define LCDEMU_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define LCD_EMU_WIDTH       240     /*GRAM columns*/
+#define LCD_EMU_HEIGHT      320     /*GRAM pages*/
+#define LCD_EMU_PARAM_MAX   16      /*stored parameters per command*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t commands;      /*bytes written with RS low*/
+    uint32_t data_bytes;    /*bytes written with RS high (parameters and pixels)*/
+    uint32_t windows;       /*RAMWR and WRMEMCONT commands*/
+    uint32_t pixels;        /*pixels stored in GRAM*/
+    uint32_t overrun;       /*pixels sent after the window had been filled*/
+    uint32_t delay_ms;      /*sum of the bus delays*/
+} LcdEmu_Stats_t;
+
+/*How the picture is looked at*/
+typedef enum {
+    LCD_EMU_VIEW_PORTRAIT,  /*240x320, the natural orientation of the module*/
+    LCD_EMU_VIEW_LANDSCAPE, /*320x240, upright for MADCTL = MV*/
+} LcdEmu_View_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Hardware reset: registers go to their default, GRAM is cleared to black
+ */
+void LcdEmu_Reset(void);
+
+/**
+ * Feed a command byte (RS low)
+ * @param cmd the command
+ */
+void LcdEmu_WriteCommand(uint8_t cmd);
+
+/**
+ * Feed a parameter or pixel byte (RS high)
+ * @param data the byte
+ */
+void LcdEmu_WriteData(uint8_t data);
+
+/**
+ * Account a delay requested on the bus
+ * @param ms delay in milliseconds
+ */
+void LcdEmu_Delay(uint32_t ms);
+
+/**
+ * Get the pixel the viewer sees
+ * @param view orientation of the viewer
+ * @param x column in the view
+ * @param y row in the view
+ * @return RGB565 colour as emitted by the panel
+ */
+uint16_t LcdEmu_GetPixel(LcdEmu_View_t view, uint32_t x, uint32_t y);
+
+/**
+ * Get the last parameter written to a command
+ * @param cmd the command
+ * @param idx index of the parameter
+ * @return the parameter byte
+ */
+uint8_t LcdEmu_GetParam(uint8_t cmd, uint32_t idx);
+
+/**
+ * Tell whether the panel shows the GRAM (out of sleep and display on)
+ * @return true: visible
+ */
+bool LcdEmu_IsDisplayOn(void);
+
+/**
+ * Get the bus statistics collected since the last LcdEmu_ClearStats()
+ * @return pointer to the statistics
+ */
+const LcdEmu_Stats_t * LcdEmu_GetStats(void);
+
+/**
+ * Zero the bus statistics, e.g. at the start of a frame
+ */
+void LcdEmu_ClearStats(void);
+
+/**
+ * Save the picture as an RGB PNG
+ * @param view orientation of the viewer
+ * @param path file to write
+ * @return true: saved
+ */
+bool LcdEmu_WritePng(LcdEmu_View_t view, const char * path);
+
+/**
+ * Compare the picture with a reference PNG.
+ * If the UPDATE_REF_IMGS environment variable is set the reference is (re)written instead.
+ * On mismatch the picture is saved next to the test binary as `<name>_err.png`.
+ * @param view orientation of the viewer
+ * @param path the reference image
+ * @return number of differing pixels, -1 if the reference can't be read
+ */
+int32_t LcdEmu_ComparePng(LcdEmu_View_t view, const char * path);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LCDEMU_H */
@@ -0,0 +1,97 @@
+/**
+ * @file TestUtil.c
+ *
+ * The random numbers are the same on every run: a failing case can be repeated.
+ * The times are measured with Perf.h, on the host they are only comparable
+ * in an optimized build (-DCMAKE_BUILD_TYPE=Release).
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "TestUtil.h"
+#include "Perf.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The mask of the line by line drawing: far from every buffer, it covers nothing*/
+#define FAR_AREA_X1     (-1000)
+#define FAR_AREA_Y1     (-1000)
+#define FAR_AREA_X2     (-900)
+#define FAR_AREA_Y2     (-900)
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rnd_state = 0x12345678;
+
+static lv_draw_mask_fade_param_t far_fade;
+static int16_t far_fade_id = LV_MASK_ID_INV;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+uint32_t TestUtil_Rnd(void)
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+void TestUtil_RandomArea(lv_area_t * area, const lv_area_t * within)
+{
+    lv_coord_t w = lv_area_get_width(within);
+    lv_coord_t h = lv_area_get_height(within);
+
+    area->x1 = within->x1 + (lv_coord_t)(TestUtil_Rnd() % w);
+    area->y1 = within->y1 + (lv_coord_t)(TestUtil_Rnd() % h);
+    area->x2 = area->x1 + (lv_coord_t)(TestUtil_Rnd() % (within->x2 - area->x1 + 1));
+    area->y2 = area->y1 + (lv_coord_t)(TestUtil_Rnd() % (within->y2 - area->y1 + 1));
+}
+
+void TestUtil_RandomBg(lv_color_t * buf, uint32_t px)
+{
+    uint32_t i;
+
+    for(i = 0; i < px; i++) buf[i].full = (uint16_t)(TestUtil_Rnd() % 4 ? 0x1234 : TestUtil_Rnd());
+}
+
+void TestUtil_LineByLine(bool en)
+{
+    if(en && far_fade_id == LV_MASK_ID_INV) {
+        lv_area_t far = {FAR_AREA_X1, FAR_AREA_Y1, FAR_AREA_X2, FAR_AREA_Y2};
+        lv_draw_mask_fade_init(&far_fade, &far, LV_OPA_COVER, far.y1, LV_OPA_COVER, far.y2);
+        far_fade_id = lv_draw_mask_add(&far_fade, NULL);
+    }
+    else if(!en && far_fade_id != LV_MASK_ID_INV) {
+        lv_draw_mask_remove_id(far_fade_id);
+        lv_draw_mask_free_param(&far_fade);
+        far_fade_id = LV_MASK_ID_INV;
+    }
+}
+
+uint32_t TestUtil_Bench(TestUtil_BenchCb_t cb, void * user_data, uint32_t runs)
+{
+    uint32_t start;
+    uint32_t i;
+
+    start = Perf_Now();
+    for(i = 0; i < runs; i++) cb(user_data);
+
+    return (uint32_t)((uint64_t)Perf_ToUs(Perf_Now() - start) * 1000 / runs);
+}
+
+void TestUtil_PrintBenchHead(const char * title, const char * ref_name, const char * new_name)
+{
+    printf("%-32s %13s [us] %13s [us]  (host)\n", title, ref_name, new_name);
+}
+
+void TestUtil_PrintBench(const char * name, uint32_t ref_ns, uint32_t new_ns)
+{
+    printf("  %-30s %18u %18u\n", name, (unsigned)(ref_ns / 1000), (unsigned)(new_ns / 1000));
+}
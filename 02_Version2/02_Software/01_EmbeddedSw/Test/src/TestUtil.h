@@ -0,0 +1,89 @@
+/**
+ * @file TestUtil.h
+ *
+ * Helpers shared by the host tests: repeatable random numbers, areas and pixels,
+ * the line by line drawing of LVGL as reference and the timing of the fast paths.
+ *
+ */
+
+#ifndef TESTUTIL_H
+#define TESTUTIL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+/*The code to measure, called repeatedly*/
+typedef void (*TestUtil_BenchCb_t)(void * user_data);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * A random number: xorshift32 with a fixed seed, the same numbers on every run
+ * @return  a 32 bit random number
+ */
+uint32_t TestUtil_Rnd(void);
+
+/**
+ * A random area with a random size inside an other
+ * @param area      the result
+ * @param within    the area to choose from
+ */
+void TestUtil_RandomArea(lv_area_t * area, const lv_area_t * within);
+
+/**
+ * A background to draw on: mostly one color, random pixels between them
+ * @param buf       the pixels to fill
+ * @param px        number of pixels
+ */
+void TestUtil_RandomBg(lv_color_t * buf, uint32_t px);
+
+/**
+ * Add or remove a mask far outside of the draw buffers.
+ * While it is active LVGL draws every line with the masks, the reference of the fast paths.
+ * @param en        true: add the mask, false: remove it
+ */
+void TestUtil_LineByLine(bool en);
+
+/**
+ * Call a function repeatedly and measure its time
+ * @param cb        the code to measure
+ * @param user_data passed to `cb`
+ * @param runs      number of calls
+ * @return          [ns] the average time of a call
+ */
+uint32_t TestUtil_Bench(TestUtil_BenchCb_t cb, void * user_data, uint32_t runs);
+
+/**
+ * Print the header of a timing table
+ * @param title     what is measured, e.g. "drawing"
+ * @param ref_name  the column of the reference, e.g. "LVGL"
+ * @param new_name  the column of the fast path, e.g. "port"
+ */
+void TestUtil_PrintBenchHead(const char * title, const char * ref_name, const char * new_name);
+
+/**
+ * Print a row of a timing table
+ * @param name      the measured case
+ * @param ref_ns    [ns] time of the reference (TestUtil_Bench())
+ * @param new_ns    [ns] time of the fast path
+ */
+void TestUtil_PrintBench(const char * name, uint32_t ref_ns, uint32_t new_ns);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* TESTUTIL_H */
@@ -0,0 +1,130 @@
+/**
+ * @file emWinHost.c
+ *
+ * STemWin replacement of the host tests: only what LCDConf.c calls, the display driver
+ * and the window manager keep the configured sizes and draw nothing.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "emWinHost.h"
+#include "GUI.h"
+#include "GUIDRV_FlexColor.h"
+#include "WM.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The handle of the desktop window*/
+#define DESKTOP_HWIN    1
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static int orientation;
+static int x_size;
+static int y_size;
+static int desktop_x_size;
+static int desktop_y_size;
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+const GUI_DEVICE_API GUIDRV_FlexColor_API = {0};
+const LCD_API_COLOR_CONV LCD_API_ColorConv_M565 = {0};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int emWinHost_GetOrientation(void)
+{
+    return orientation;
+}
+
+void emWinHost_GetDesktopSize(int * x, int * y)
+{
+    *x = desktop_x_size;
+    *y = desktop_y_size;
+}
+
+GUI_DEVICE * GUI_DEVICE_CreateAndLink(const GUI_DEVICE_API * pDeviceAPI, const LCD_API_COLOR_CONV * pColorConvAPI,
+                                      U16 Flags, int LayerIndex)
+{
+    static GUI_DEVICE device;
+
+    (void)pColorConvAPI;
+    (void)Flags;
+    (void)LayerIndex;
+    device.pDeviceAPI = pDeviceAPI;
+    return &device;
+}
+
+void GUIDRV_FlexColor_Config(GUI_DEVICE * pDevice, CONFIG_FLEXCOLOR * pConfig)
+{
+    (void)pDevice;
+    orientation = pConfig->Orientation;
+}
+
+void GUIDRV_FlexColor_SetFunc(GUI_DEVICE * pDevice, GUI_PORT_API * pHW_API, void (* pfFunc)(GUI_DEVICE *),
+                              void (* pfMode)(GUI_DEVICE *))
+{
+    (void)pHW_API;
+    pfFunc(pDevice);
+    pfMode(pDevice);
+}
+
+void GUIDRV_FlexColor_SetFunc66709(GUI_DEVICE * pDevice)
+{
+    (void)pDevice;
+}
+
+void GUIDRV_FlexColor_SetMode16bppC0B8(GUI_DEVICE * pDevice)
+{
+    (void)pDevice;
+}
+
+int LCD_SetSizeEx(int LayerIndex, int xSize, int ySize)
+{
+    (void)LayerIndex;
+    x_size = xSize;
+    y_size = ySize;
+    return 0;
+}
+
+int LCD_SetVSizeEx(int LayerIndex, int xSize, int ySize)
+{
+    (void)LayerIndex;
+    (void)xSize;
+    (void)ySize;
+    return 0;
+}
+
+int LCD_GetXSize(void)
+{
+    return x_size;
+}
+
+int LCD_GetYSize(void)
+{
+    return y_size;
+}
+
+WM_HWIN WM_GetDesktopWindow(void)
+{
+    return DESKTOP_HWIN;
+}
+
+void WM_SetSize(WM_HWIN hWin, int XSize, int YSize)
+{
+    if(hWin != DESKTOP_HWIN) return;
+    desktop_x_size = XSize;
+    desktop_y_size = YSize;
+}
+
+void WM_InvalidateWindow(WM_HWIN hWin)
+{
+    (void)hWin;
+}
@@ -0,0 +1,37 @@
+/**
+ * @file emWinHost.h
+ *
+ * The parts of STemWin used by LCDConf.c, for the host tests: the library is built for Cortex-M only.
+ * The sizes and the orientation LCDConf.c configures are stored and reported back the way emWin does.
+ *
+ */
+
+#ifndef EMWINHOST_H
+#define EMWINHOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Get the orientation given to GUIDRV_FlexColor_Config()
+ * @return GUI_SWAP_XY, GUI_MIRROR_X and GUI_MIRROR_Y flags
+ */
+int emWinHost_GetOrientation(void);
+
+/**
+ * Get the size of the desktop window set with WM_SetSize()
+ * @param x  the width is stored here
+ * @param y  the height is stored here
+ */
+void emWinHost_GetDesktopSize(int * x, int * y);
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*EMWINHOST_H*/
@@ -0,0 +1,137 @@
+/**
+ * @file test_backlight.c
+ *
+ * The backlight state machine (LcdBacklight.c) driving the ILI9341 model.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "LcdBacklight.h"
+#include "LcdEmu.h"
+#include "unity/unity.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define T0  1000
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint8_t brightness(void);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    LcdPanel_Init();
+    LcdBacklight_Init(T0);
+    LcdEmu_ClearStats();
+}
+
+void tearDown(void)
+{
+}
+
+void test_init(void)
+{
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    TEST_ASSERT_EQUAL_UINT8(LCD_BACKLIGHT_LEVEL_ON, brightness());
+    TEST_ASSERT_EQUAL_HEX8(CTRLD_BCTRL | CTRLD_DD | CTRLD_BL, LcdEmu_GetParam(ILI9341_WRCTRLD, 0));
+}
+
+void test_in_use(void)
+{
+    uint32_t t;
+
+    /*Out of the holder the backlight stays on and nothing is sent*/
+    for(t = T0; t < T0 + 2 * LCD_BACKLIGHT_OFF_DELAY; t += 100) {
+        LcdBacklight_Handler(false, false, t);
+    }
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->commands);
+}
+
+void test_dim_and_off(void)
+{
+    uint32_t t = T0;
+
+    LcdBacklight_Handler(true, false, t);
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY - 1);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_DIM, LcdBacklight_GetState());
+    TEST_ASSERT_EQUAL_UINT8(LCD_BACKLIGHT_LEVEL_DIM, brightness());
+
+    t += LCD_BACKLIGHT_OFF_DELAY;
+    LcdBacklight_Handler(true, false, t);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_FADE_OFF, LcdBacklight_GetState());
+    TEST_ASSERT_EQUAL_UINT8(0, brightness());
+    TEST_ASSERT_TRUE(LcdEmu_IsDisplayOn());
+
+    /*The panel sleeps only when the hardware fade has finished*/
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_FADE_TIME);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_OFF, LcdBacklight_GetState());
+    TEST_ASSERT_FALSE(LcdEmu_IsDisplayOn());
+
+    /*Taking out the iron wakes up the panel*/
+    LcdBacklight_Handler(false, false, t + LCD_BACKLIGHT_FADE_TIME + 100);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    TEST_ASSERT_TRUE(LcdEmu_IsDisplayOn());
+    TEST_ASSERT_EQUAL_UINT8(LCD_BACKLIGHT_LEVEL_ON, brightness());
+}
+
+void test_activity_in_holder(void)
+{
+    uint32_t t = T0;
+
+    LcdBacklight_Handler(true, false, t);
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_DIM, LcdBacklight_GetState());
+
+    /*Turning the encoder lights up the display and restarts the timers*/
+    t += LCD_BACKLIGHT_DIM_DELAY + 500;
+    LcdBacklight_Handler(true, true, t);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY - 1);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_DIM, LcdBacklight_GetState());
+}
+
+void test_tick_overflow(void)
+{
+    uint32_t t = UINT32_MAX - LCD_BACKLIGHT_DIM_DELAY / 2;
+
+    LcdBacklight_Init(t);
+    LcdBacklight_Handler(true, false, t);
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY - 1);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_ON, LcdBacklight_GetState());
+    LcdBacklight_Handler(true, false, t + LCD_BACKLIGHT_DIM_DELAY);
+    TEST_ASSERT_EQUAL(LCD_BACKLIGHT_DIM, LcdBacklight_GetState());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_init);
+    RUN_TEST(test_in_use);
+    RUN_TEST(test_dim_and_off);
+    RUN_TEST(test_activity_in_holder);
+    RUN_TEST(test_tick_overflow);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint8_t brightness(void)
+{
+    return LcdEmu_GetParam(ILI9341_WRDISBV, 0);
+}
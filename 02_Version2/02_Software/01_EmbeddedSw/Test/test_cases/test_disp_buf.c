@@ -0,0 +1,277 @@
+/**
+ * @file test_disp_buf.c
+ *
+ * Frame time against the size of the draw buffers (lv_port_disp.c).
+ * Every stripe of LVGL costs a flush (CASET, PASET, RAMWR) and a walk of the object tree,
+ * the pixels are the same with any buffer. Prints the host rendering time and the bus
+ * traffic of full frames per buffer size and checks that the pictures don't change.
+ * Small invalid areas close to each other are refreshed with one flush (area_cost_cb).
+ * The overdraw of a frame: the root of the screen is not drawn under the opaque children.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "SolderingScreen.h"
+#include "TrendScreen.h"
+#include "LcdEmu.h"
+#include "Perf.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+/*Frames rendered per measurement*/
+#define FRAMES          20
+
+/*Bytes of the window setup of a flush: CASET, PASET, RAMWR and their parameters*/
+#define WINDOW_BYTES    11
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void bench(const char * name);
+static uint32_t frame_us(void);
+static uint32_t refr_areas(const lv_area_t * areas, uint32_t cnt);
+static uint16_t history(uint32_t i);
+static void draw_main_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const SolderingModel_t heating = {
+    .SetPoint = 320,
+    .ActiveSetPoint = 320,
+    .TipTemperature = 315,
+    .HeatingPower = 40,
+    .State = SOLDERING_STATE_HEATING,
+};
+
+static const uint32_t lines[] = {1, 2, 4, 8, 12, 16, LV_PORT_DISP_BUF_LINES};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void tearDown(void)
+{
+    lv_port_disp_set_buf_lines(LV_PORT_DISP_BUF_LINES, LV_PORT_DISP_DOUBLE_BUF);
+}
+
+void test_soldering_screen(void)
+{
+    SolderingModel_Update(&heating);
+    SolderingScreen_Create(lv_scr_act());
+    bench("soldering_heating");
+}
+
+void test_trend_screen(void)
+{
+    uint32_t i;
+
+    TempTrend_Clear();
+    for(i = 0; i < TREND_SCREEN_COLUMNS * TEMP_TREND_BUCKET + 5; i++) TempTrend_Add(history(i));
+    TrendScreen_Create(lv_scr_act());
+    TrendScreen_SetWindow(TREND_SCREEN_WINDOW_LONG);
+    bench("trend_long");
+}
+
+void test_join_areas(void)
+{
+    /*Two small areas 5 px apart and one far below them*/
+    static const lv_area_t areas[] = {
+        {10, 10, 29, 29},
+        {35, 10, 54, 29},
+        {10, 200, 29, 219},
+    };
+    lv_port_disp_cost_t cost_def;
+    lv_port_disp_cost_t cost_px;
+
+    /*The default profile on the host*/
+    TEST_ASSERT_NOT_NULL(lv_port_disp_get_cost());
+    cost_def = *lv_port_disp_get_cost();
+    TEST_ASSERT_EQUAL_UINT32(LV_PORT_DISP_COST_WINDOW_NS, cost_def.window_ns);
+
+    SolderingModel_Update(&heating);
+    SolderingScreen_Create(lv_scr_act());
+    lv_refr_now(NULL);
+
+    /*LVGL joins only the areas with common parts*/
+    lv_port_disp_set_cost(NULL);
+    TEST_ASSERT_NULL(lv_port_disp_get_cost());
+    TEST_ASSERT_EQUAL_UINT32(3, refr_areas(areas, 3));
+
+    /*The window setup and the walk of the objects cost more than the 5 columns between*/
+    lv_port_disp_set_cost(&cost_def);
+    TEST_ASSERT_EQUAL_UINT32(2, refr_areas(areas, 3));
+
+    /*Nothing to join if only the pixels cost*/
+    cost_px = cost_def;
+    cost_px.window_ns = 0;
+    cost_px.stripe_ns = 0;
+    lv_port_disp_set_cost(&cost_px);
+    TEST_ASSERT_EQUAL_UINT32(3, refr_areas(areas, 3));
+
+    lv_port_disp_set_cost(&cost_def);
+}
+
+void test_overdraw(void)
+{
+    const lv_port_disp_stats_t * ds = lv_port_disp_get_stats();
+
+    SolderingModel_Update(&heating);
+    lv_obj_t * root = SolderingScreen_Create(lv_scr_act());
+    frame_us();
+
+    printf("soldering_heating: %u px, drawn %u px, skipped %u px per frame\n", (unsigned)(ds->px / FRAMES),
+           (unsigned)(ds->drawn_px / FRAMES), (unsigned)(ds->skipped_px / FRAMES));
+
+    TEST_ASSERT_EQUAL_UINT32(FRAMES * LCD_PANEL_WIDTH * LCD_PANEL_HEIGHT, ds->px);
+    TEST_ASSERT_EQUAL_UINT32(ds->drawn_px / FRAMES, lv_refr_get_overdraw()->drawn_px);
+    TEST_ASSERT_EQUAL_UINT32(ds->skipped_px / FRAMES, lv_refr_get_overdraw()->skipped_px);
+    /*The root covers the screen*/
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(ds->px, ds->drawn_px + ds->skipped_px);
+#if LV_REFR_OCCLUSION
+    /*The digits and the power bar cover the root, its LV_EVENT_DELETE callback doesn't matter*/
+    TEST_ASSERT_GREATER_THAN_UINT32(0, ds->skipped_px);
+
+    /*A callback of the draw events gets them once per stripe: the root is drawn in one piece*/
+    lv_obj_add_event_cb(root, draw_main_cb, LV_EVENT_DRAW_MAIN, NULL);
+    frame_us();
+    TEST_ASSERT_EQUAL_UINT32(0, ds->skipped_px);
+    lv_obj_remove_event_cb(root, draw_main_cb);
+#else
+    LV_UNUSED(root);
+    TEST_ASSERT_EQUAL_UINT32(0, ds->skipped_px);
+#endif
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("soldering_heating")));
+}
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+    lv_port_disp_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_soldering_screen);
+    RUN_TEST(test_trend_screen);
+    RUN_TEST(test_join_areas);
+    RUN_TEST(test_overdraw);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Render the screen with every buffer size, single and double buffered
+ * @param name  the reference image of the screen
+ */
+static void bench(const char * name)
+{
+    char path[256];
+    uint32_t i;
+    uint32_t d;
+
+    snprintf(path, sizeof(path), REF_IMG("%s"), name);
+
+    printf("%s: %d x %d\n", name, (int)LV_HOR_RES, (int)LV_VER_RES);
+    printf("  lines  buffers  [bytes]  flushes  window bytes  frame [us, host]\n");
+    for(d = 0; d <= LV_PORT_DISP_DOUBLE_BUF; d++) {
+        for(i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+            lv_port_disp_set_buf_lines(lines[i], d);
+            uint32_t us = frame_us();
+
+            /*Stats of FRAMES frames*/
+            const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+            uint32_t flushes = s->windows / FRAMES;
+            printf("  %5u  %7u  %7u  %7u  %12u  %16u\n", (unsigned)lines[i], (unsigned)(d + 1),
+                   (unsigned)((d + 1) * lines[i] * LCD_PANEL_HEIGHT * sizeof(lv_color_t)),
+                   (unsigned)flushes, (unsigned)(flushes * WINDOW_BYTES), (unsigned)us);
+
+            /*Full width stripes of `lines` rows*/
+            TEST_ASSERT_EQUAL_UINT32((LV_VER_RES + lines[i] - 1) / lines[i], flushes);
+            TEST_ASSERT_EQUAL_UINT32(FRAMES * LCD_PANEL_WIDTH * LCD_PANEL_HEIGHT, s->pixels);
+            TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, path));
+
+            /*The statistics of the port see the same refreshes*/
+            const lv_port_disp_stats_t * ds = lv_port_disp_get_stats();
+            TEST_ASSERT_EQUAL_UINT32(FRAMES, ds->refreshes);
+            TEST_ASSERT_EQUAL_UINT32(s->windows, ds->flushes);
+            TEST_ASSERT_EQUAL_UINT32(s->pixels, ds->px);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(ds->refr_us, ds->flush_us);
+        }
+    }
+}
+
+/**
+ * Redraw the whole screen FRAMES times
+ * @return  [us] the average time of a frame
+ */
+static uint32_t frame_us(void)
+{
+    uint32_t start;
+    uint32_t i;
+
+    LcdEmu_ClearStats();
+    lv_port_disp_clear_stats();
+    start = Perf_Now();
+    for(i = 0; i < FRAMES; i++) {
+        lv_obj_invalidate(lv_scr_act());
+        lv_refr_now(NULL);
+    }
+
+    return Perf_ToUs(Perf_Now() - start) / FRAMES;
+}
+
+/**
+ * Invalidate areas of the screen and refresh them
+ * @param areas     the areas to invalidate
+ * @param cnt       number of areas
+ * @return          the flushes of the refresh
+ */
+static uint32_t refr_areas(const lv_area_t * areas, uint32_t cnt)
+{
+    uint32_t i;
+
+    LcdEmu_ClearStats();
+    for(i = 0; i < cnt; i++) lv_obj_invalidate_area(lv_scr_act(), &areas[i]);
+    lv_refr_now(NULL);
+
+    /*Only the pixels of the areas were redrawn: the same picture*/
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("soldering_heating")));
+    return LcdEmu_GetStats()->windows;
+}
+
+/**
+ * The tip temperature of test_trend_screen.c: heating up, then joints soldered
+ */
+static uint16_t history(uint32_t i)
+{
+    uint32_t t;
+    uint32_t joint = i % 1100;
+
+    if(i < 100) return (uint16_t)(25 + i * 295 / 100);
+
+    t = 320 + (i * 7) % 5;
+    if(joint >= 1000 && joint < 1010) t -= (joint - 1000) * 8;
+    else if(joint >= 1010 && joint < 1050) t -= 80 - (joint - 1010) * 2;
+    return (uint16_t)t;
+}
+
+static void draw_main_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
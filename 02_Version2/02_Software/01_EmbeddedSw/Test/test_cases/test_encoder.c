@@ -0,0 +1,237 @@
+/**
+ * @file test_encoder.c
+ *
+ * The rotary encoder (Encoder.c) and its LVGL input device (lv_port_indev.c).
+ * Checks the acceleration, the routing of the detents and that the button edges
+ * reach the focused object as keys, clicks and long presses.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_indev.h"
+#include "unity/unity.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define T0          1000
+#define SLOW        200     /*[ms] between two detents: no acceleration*/
+#define GUI_PERIOD  10      /*[ms] cycle of the GUI task*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    uint32_t right;
+    uint32_t left;
+    uint32_t short_clicked;
+    uint32_t long_pressed;
+} events_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void event_cb(lv_event_t * e);
+static void gui_cycles(uint32_t n);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static events_t events;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_group_t * g = lv_port_indev_get_group();
+    bool pressed;
+
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(obj, event_cb, LV_EVENT_ALL, NULL);
+
+    /*As the GUI task shows a view*/
+    lv_group_remove_all_objs(g);
+    lv_group_add_obj(g, obj);
+    lv_group_set_editing(g, true);
+
+    while(Encoder_GetButtonEvent(&pressed));
+    Encoder_Init(0, T0);
+    memset(&events, 0, sizeof(events));
+}
+
+void tearDown(void)
+{
+}
+
+void test_acceleration(void)
+{
+    /*Slow: a step per detent*/
+    Encoder_Update(1, T0 + SLOW);
+    Encoder_Update(3, T0 + 3 * SLOW);
+    TEST_ASSERT_EQUAL_INT32(3, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+    TEST_ASSERT_EQUAL_INT32(0, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+
+    /*Fast: 4 detents in 40 ms*/
+    Encoder_Update(7, T0 + 3 * SLOW + 40);
+    TEST_ASSERT_EQUAL_INT32(4 * 8, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+
+    /*Medium, backwards: 2 detents in 100 ms*/
+    Encoder_Update(5, T0 + 3 * SLOW + 140);
+    TEST_ASSERT_EQUAL_INT32(-2 * 2, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+}
+
+void test_counter_wrap(void)
+{
+    Encoder_Init(0xFFFE, T0);
+    Encoder_Update(0x0001, T0 + 3 * SLOW);
+    TEST_ASSERT_EQUAL_INT32(3, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+    Encoder_Update(0xFFFF, T0 + 5 * SLOW);
+    TEST_ASSERT_EQUAL_INT32(-2, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+}
+
+void test_target(void)
+{
+    Encoder_Update(2, T0 + 2 * SLOW);
+    TEST_ASSERT_FALSE(Encoder_HasSteps(ENCODER_TARGET_GUI));
+    TEST_ASSERT_EQUAL_INT32(0, Encoder_TakeSteps(ENCODER_TARGET_GUI));
+    TEST_ASSERT_TRUE(Encoder_HasSteps(ENCODER_TARGET_SETPOINT));
+
+    /*The detents of the setpoint don't leak into the GUI*/
+    Encoder_SetTarget(ENCODER_TARGET_GUI);
+    TEST_ASSERT_FALSE(Encoder_HasSteps(ENCODER_TARGET_GUI));
+    Encoder_Update(3, T0 + 3 * SLOW);
+    TEST_ASSERT_EQUAL_INT32(0, Encoder_TakeSteps(ENCODER_TARGET_SETPOINT));
+    TEST_ASSERT_EQUAL_INT32(1, Encoder_TakeSteps(ENCODER_TARGET_GUI));
+}
+
+void test_button_queue(void)
+{
+    bool pressed;
+    uint32_t i;
+
+    Encoder_ButtonEvent(true);
+    Encoder_ButtonEvent(false);
+    TEST_ASSERT_TRUE(Encoder_GetButtonEvent(&pressed));
+    TEST_ASSERT_TRUE(pressed);
+    TEST_ASSERT_TRUE(Encoder_GetButtonEvent(&pressed));
+    TEST_ASSERT_FALSE(pressed);
+    TEST_ASSERT_FALSE(Encoder_GetButtonEvent(&pressed));
+
+    /*Full: the newest edges are dropped*/
+    for(i = 0; i < ENCODER_BUTTON_QUEUE_SIZE + 2; i++) Encoder_ButtonEvent(i % 2 == 0);
+    for(i = 0; i < ENCODER_BUTTON_QUEUE_SIZE; i++) {
+        TEST_ASSERT_TRUE(Encoder_GetButtonEvent(&pressed));
+        TEST_ASSERT_EQUAL(i % 2 == 0, pressed);
+    }
+    TEST_ASSERT_FALSE(Encoder_GetButtonEvent(&pressed));
+}
+
+void test_indev_rotation(void)
+{
+    Encoder_SetTarget(ENCODER_TARGET_GUI);
+    Encoder_Update(2, T0 + 2 * SLOW);
+    gui_cycles(1);
+    TEST_ASSERT_EQUAL_UINT32(2, events.right);
+
+    Encoder_Update(1, T0 + 3 * SLOW);
+    gui_cycles(1);
+    TEST_ASSERT_EQUAL_UINT32(1, events.left);
+    TEST_ASSERT_FALSE(Encoder_HasSteps(ENCODER_TARGET_GUI));
+
+    /*On the setpoint the GUI gets nothing*/
+    Encoder_SetTarget(ENCODER_TARGET_SETPOINT);
+    Encoder_Update(5, T0 + 7 * SLOW);
+    gui_cycles(1);
+    TEST_ASSERT_EQUAL_UINT32(2, events.right);
+}
+
+void test_indev_short_click(void)
+{
+    /*Pressed and released within a GUI cycle*/
+    Encoder_ButtonEvent(true);
+    Encoder_ButtonEvent(false);
+    gui_cycles(1);
+    TEST_ASSERT_EQUAL_UINT32(1, events.short_clicked);
+    TEST_ASSERT_EQUAL_UINT32(0, events.long_pressed);
+}
+
+void test_indev_long_press(void)
+{
+    Encoder_ButtonEvent(true);
+    gui_cycles(LV_PORT_INDEV_LONG_PRESS_TIME / GUI_PERIOD - 5);
+    TEST_ASSERT_EQUAL_UINT32(0, events.long_pressed);
+
+    /*Read while held, without new edges*/
+    gui_cycles(10);
+    TEST_ASSERT_EQUAL_UINT32(1, events.long_pressed);
+
+    Encoder_ButtonEvent(false);
+    gui_cycles(1);
+    TEST_ASSERT_EQUAL_UINT32(1, events.long_pressed);
+    TEST_ASSERT_EQUAL_UINT32(0, events.short_clicked);
+}
+
+void test_indev_idle(void)
+{
+    lv_indev_t * indev = lv_indev_get_next(NULL);
+
+    TEST_ASSERT_TRUE(indev->driver->read_timer->paused);
+    gui_cycles(100);
+    TEST_ASSERT_EQUAL_UINT32(0, events.right + events.left + events.short_clicked + events.long_pressed);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+    lv_port_indev_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_acceleration);
+    RUN_TEST(test_counter_wrap);
+    RUN_TEST(test_target);
+    RUN_TEST(test_button_queue);
+    RUN_TEST(test_indev_rotation);
+    RUN_TEST(test_indev_short_click);
+    RUN_TEST(test_indev_long_press);
+    RUN_TEST(test_indev_idle);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if(code == LV_EVENT_KEY) {
+        uint32_t key = lv_event_get_key(e);
+        if(key == LV_KEY_RIGHT) events.right++;
+        else if(key == LV_KEY_LEFT) events.left++;
+    }
+    else if(code == LV_EVENT_SHORT_CLICKED) events.short_clicked++;
+    else if(code == LV_EVENT_LONG_PRESSED) events.long_pressed++;
+}
+
+/**
+ * Run `n` cycles of the GUI task
+ */
+static void gui_cycles(uint32_t n)
+{
+    while(n--) {
+        lv_tick_inc(GUI_PERIOD);
+        lv_port_indev_process();
+        lv_timer_handler();
+    }
+}
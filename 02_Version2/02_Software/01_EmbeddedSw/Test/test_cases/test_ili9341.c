@@ -0,0 +1,282 @@
+/**
+ * @file test_ili9341.c
+ *
+ * The LVGL port (lv_port_disp.c, ILI9341.c, LcdPanel.c) running on the ILI9341 model.
+ * Checks the bus traffic of the frames and compares the pictures with ref_imgs/.
+ * The emWin configuration (LCDConf.c) has to give the same screen size as LVGL in every rotation.
+ * Regenerate the references with `UPDATE_REF_IMGS=1 ctest` after an intended change.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "LcdEmu.h"
+#include "LCDConf.h"
+#include "emWinHost.h"
+#include "lv_examples.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+/*0xRRGGBB to RGB565 as the panel shows it*/
+#define RGB565(c)       ((uint16_t)((((c) >> 8) & 0xF800) | (((c) >> 5) & 0x07E0) | (((c) >> 3) & 0x001F)))
+
+/*Bytes of the window setup preceding every flush: CASET and PASET parameters*/
+#define WINDOW_DATA_BYTES   8
+/*CASET, PASET and RAMWR*/
+#define WINDOW_COMMANDS     3
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void frame_print(const char * name);
+static void frame_check_overhead(void);
+static uint16_t view_pixel(lv_disp_rot_t rot, uint32_t x, uint32_t y);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_example_anim_3();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    LcdEmu_ClearStats();
+}
+
+void tearDown(void)
+{
+}
+
+void test_init_sequence(void)
+{
+    LcdEmu_ClearStats();
+    ili9341_init();
+
+    TEST_ASSERT_TRUE(LcdEmu_IsDisplayOn());
+    TEST_ASSERT_EQUAL_HEX8(MADCTL_MV | MADCTL_BGR, LcdEmu_GetParam(ILI9341_MADCTL, 0));
+    TEST_ASSERT_EQUAL_HEX8(0x55, LcdEmu_GetParam(ILI9341_PIXSET, 0));
+    TEST_ASSERT_EQUAL_UINT32(10 + 120, LcdEmu_GetStats()->delay_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->windows);
+    frame_print("init");
+}
+
+void test_full_frame(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    frame_print("full frame");
+
+    const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+    TEST_ASSERT_EQUAL_UINT32(LCD_PANEL_WIDTH * LCD_PANEL_HEIGHT, s->pixels);
+    TEST_ASSERT_EQUAL_UINT32(0, s->overrun);
+    frame_check_overhead();
+
+    /*Every flush has to use the whole draw buffer*/
+    uint32_t rows = LV_PORT_DISP_BUF_SIZE / LV_HOR_RES;
+    TEST_ASSERT_EQUAL_UINT32((LV_VER_RES + rows - 1) / rows, s->windows);
+
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("boot_screen")));
+}
+
+void test_idle_frame(void)
+{
+    lv_refr_now(NULL);
+
+    const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+    TEST_ASSERT_EQUAL_UINT32(0, s->commands);
+    TEST_ASSERT_EQUAL_UINT32(0, s->data_bytes);
+}
+
+void test_partial_frame(void)
+{
+    lv_area_t a;
+    lv_area_set(&a, 100, 150, 109, 159);
+    _lv_inv_area(NULL, &a);
+    lv_refr_now(NULL);
+    frame_print("10x10 area");
+
+    const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+    TEST_ASSERT_EQUAL_UINT32(1, s->windows);
+    TEST_ASSERT_EQUAL_UINT32(100, s->pixels);
+    frame_check_overhead();
+
+    /*Redrawing the same content mustn't change the picture*/
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("boot_screen")));
+}
+
+void test_pixel_format(void)
+{
+    /*Pure colours: a byte or red/blue swap would be visible*/
+    static const uint32_t colors[] = {0xFF0000, 0x00FF00, 0x0000FF, 0x102030};
+    uint32_t i;
+
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+
+    for(i = 0; i < sizeof(colors) / sizeof(colors[0]); i++) {
+        lv_obj_set_style_bg_color(obj, lv_color_hex(colors[i]), 0);
+        lv_refr_now(NULL);
+        TEST_ASSERT_EQUAL_HEX16(RGB565(colors[i]), LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, 10, 10));
+        TEST_ASSERT_EQUAL_HEX16(RGB565(colors[i]), LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, 319, 239));
+    }
+}
+
+void test_window_madctl(void)
+{
+    static const uint8_t px[4] = {0xF8, 0x00, 0x00, 0x1F};    /*red, blue*/
+
+    /*Landscape: the two pixels have to appear at (0;0) and (1;0) when turned by 90 degrees*/
+    LcdPanel_SetMadctl(MADCTL_MV | MADCTL_BGR);
+    LcdPanel_SetWindow(0, 0, 1, 0);
+    LcdBus_WriteDataMultiple(px, sizeof(px));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, 0, 0));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, 1, 0));
+
+    /*Portrait without BGR: red and blue are exchanged by the filter*/
+    LcdPanel_SetMadctl(MADCTL_MX | MADCTL_RGB);
+    LcdPanel_SetWindow(10, 20, 11, 20);
+    LcdBus_WriteDataMultiple(px, sizeof(px));
+    TEST_ASSERT_EQUAL_HEX16(0x001F, LcdEmu_GetPixel(LCD_EMU_VIEW_PORTRAIT, 10, 20));
+    TEST_ASSERT_EQUAL_HEX16(0xF800, LcdEmu_GetPixel(LCD_EMU_VIEW_PORTRAIT, 11, 20));
+
+    /*Writing past the window is counted*/
+    LcdPanel_SetWindow(0, 0, 0, 0);
+    LcdBus_WriteDataMultiple(px, sizeof(px));
+    TEST_ASSERT_EQUAL_UINT32(1, LcdEmu_GetStats()->overrun);
+
+    LcdPanel_SetRotation(LcdPanel_GetRotation());
+}
+
+void test_rotation(void)
+{
+    lv_disp_rot_t rot;
+
+    /*Markers in the top left and bottom right corners*/
+    lv_obj_t * tl = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(tl);
+    lv_obj_set_size(tl, 4, 4);
+    lv_obj_set_style_bg_opa(tl, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(tl, lv_color_hex(0xFF0000), 0);
+
+    lv_obj_t * br = lv_obj_create(lv_layer_top());
+    lv_obj_remove_style_all(br);
+    lv_obj_set_size(br, 4, 4);
+    lv_obj_set_style_bg_opa(br, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(br, lv_color_hex(0x0000FF), 0);
+    lv_obj_align(br, LV_ALIGN_BOTTOM_RIGHT, 0, 0);
+
+    for(rot = LV_DISP_ROT_NONE; rot <= LV_DISP_ROT_270; rot++) {
+        lv_disp_set_rotation(NULL, rot);
+        LcdEmu_ClearStats();
+        lv_refr_now(NULL);
+
+        TEST_ASSERT_EQUAL(LcdPanel_GetHorRes(), LV_HOR_RES);
+        TEST_ASSERT_EQUAL(LcdPanel_GetVerRes(), LV_VER_RES);
+        TEST_ASSERT_EQUAL_UINT32(LCD_PANEL_WIDTH * LCD_PANEL_HEIGHT, LcdEmu_GetStats()->pixels);
+        TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->overrun);
+        frame_check_overhead();
+
+        TEST_ASSERT_EQUAL_HEX16(0xF800, view_pixel(rot, 0, 0));
+        TEST_ASSERT_EQUAL_HEX16(0x001F, view_pixel(rot, LV_HOR_RES - 1, LV_VER_RES - 1));
+    }
+
+    lv_obj_del(tl);
+    lv_obj_del(br);
+    lv_disp_set_rotation(NULL, (lv_disp_rot_t)LCD_PANEL_ROTATION);
+}
+
+void test_emwin_rotation(void)
+{
+    lv_disp_rot_t rot;
+    int x_size;
+    int y_size;
+
+    /*At start up: LCD_PANEL_ROTATION*/
+    LCD_X_Config();
+    TEST_ASSERT_EQUAL(LV_HOR_RES, LCD_GetXSize());
+    TEST_ASSERT_EQUAL(LV_VER_RES, LCD_GetYSize());
+
+    for(rot = LV_DISP_ROT_NONE; rot <= LV_DISP_ROT_270; rot++) {
+        lv_disp_set_rotation(NULL, rot);
+        uint8_t madctl = LcdEmu_GetParam(ILI9341_MADCTL, 0);
+
+        LcdConf_SetRotation((LcdPanel_Rotation_t)rot);
+        TEST_ASSERT_EQUAL(LV_HOR_RES, LCD_GetXSize());
+        TEST_ASSERT_EQUAL(LV_VER_RES, LCD_GetYSize());
+        TEST_ASSERT_EQUAL(LV_HOR_RES > LV_VER_RES, (emWinHost_GetOrientation() & GUI_SWAP_XY) != 0);
+        TEST_ASSERT_EQUAL_HEX8(madctl, LcdEmu_GetParam(ILI9341_MADCTL, 0));
+
+        emWinHost_GetDesktopSize(&x_size, &y_size);
+        TEST_ASSERT_EQUAL(LV_HOR_RES, x_size);
+        TEST_ASSERT_EQUAL(LV_VER_RES, y_size);
+    }
+
+    lv_disp_set_rotation(NULL, (lv_disp_rot_t)LCD_PANEL_ROTATION);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_init_sequence);
+    RUN_TEST(test_full_frame);
+    RUN_TEST(test_idle_frame);
+    RUN_TEST(test_partial_frame);
+    RUN_TEST(test_pixel_format);
+    RUN_TEST(test_window_madctl);
+    RUN_TEST(test_rotation);
+    RUN_TEST(test_emwin_rotation);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void frame_print(const char * name)
+{
+    const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+    printf("%-12s commands: %6u, data bytes: %7u, windows: %4u, pixels: %6u\n", name,
+           (unsigned)s->commands, (unsigned)s->data_bytes, (unsigned)s->windows, (unsigned)s->pixels);
+}
+
+/**
+ * Nothing else than the window setup and the pixels may go to the bus during a frame
+ */
+static void frame_check_overhead(void)
+{
+    const LcdEmu_Stats_t * s = LcdEmu_GetStats();
+    TEST_ASSERT_EQUAL_UINT32(s->windows * WINDOW_COMMANDS, s->commands);
+    TEST_ASSERT_EQUAL_UINT32(s->windows * WINDOW_DATA_BYTES + s->pixels * 2, s->data_bytes);
+}
+
+/**
+ * Get a pixel by its logical coordinates: where a viewer holding the device
+ * in the given orientation sees it
+ */
+static uint16_t view_pixel(lv_disp_rot_t rot, uint32_t x, uint32_t y)
+{
+    switch(rot) {
+        case LV_DISP_ROT_90:
+            return LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, LCD_PANEL_HEIGHT - 1 - x, LCD_PANEL_WIDTH - 1 - y);
+        case LV_DISP_ROT_180:
+            return LcdEmu_GetPixel(LCD_EMU_VIEW_PORTRAIT, LCD_PANEL_WIDTH - 1 - x, LCD_PANEL_HEIGHT - 1 - y);
+        case LV_DISP_ROT_270:
+            return LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, x, y);
+        default:
+            return LcdEmu_GetPixel(LCD_EMU_VIEW_PORTRAIT, x, y);
+    }
+}
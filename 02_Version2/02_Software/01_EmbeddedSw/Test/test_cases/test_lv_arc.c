@@ -0,0 +1,226 @@
+/**
+ * @file test_lv_arc.c
+ *
+ * The arcs of lv_draw_sw_arc.c drawn only between the outer circle and the hole of every line
+ * (LV_ARC_SPANS, off in lv_conf.h, on in the host tests), the spans come from the cached circles
+ * (LV_CIRCLE_CACHE_SIZE).
+ * Random opaque arcs have to give the same pixels as the line by line drawing of LVGL over the whole
+ * bounding box of the quarters, which is used when an other mask is active.
+ * Prints the host time of typical gauges without and with the spans.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_blend.h"
+#include "lv_port_cache.h"
+#include "Perf.h"
+#include "TestUtil.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The draw buffer: a square of the panel, large enough for a gauge*/
+#define BUF_W           160
+#define BUF_H           160
+
+/*Random arcs per test*/
+#define RUNS            1000
+
+/*Drawings per measurement*/
+#define BENCH_RUNS      100
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_draw_arc_dsc_t * dsc;
+    uint16_t radius;
+    uint16_t start;
+    uint16_t end;
+} bench_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void draw_both(const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
+                      uint16_t start, uint16_t end);
+static void draw(lv_color_t * buf, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
+                 uint16_t start, uint16_t end, bool line_by_line);
+static void bench_cb(void * user_data);
+static void print_bench(const char * name, const lv_draw_arc_dsc_t * dsc, uint16_t radius, uint16_t start,
+                        uint16_t end);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_draw_sw_ctx_t ctx;
+static lv_area_t buf_area;
+static lv_area_t clip_area;
+
+static lv_color_t buf_ref[BUF_W * BUF_H];
+static lv_color_t buf_fast[BUF_W * BUF_H];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_port_blend_ctx_init(lv_disp_get_default()->driver, &ctx.base_draw);
+    lv_area_set(&buf_area, 0, 0, BUF_W - 1, BUF_H - 1);
+    ctx.base_draw.buf_area = &buf_area;
+    ctx.base_draw.clip_area = &clip_area;
+}
+
+void tearDown(void)
+{
+}
+
+void test_arc(void)
+{
+    lv_draw_arc_dsc_t dsc;
+    lv_point_t center;
+    uint16_t radius;
+    uint32_t i;
+
+    for(i = 0; i < RUNS; i++) {
+        lv_draw_arc_dsc_init(&dsc);
+        dsc.color.full = (uint16_t)TestUtil_Rnd();
+        dsc.opa = LV_OPA_COVER;
+        dsc.rounded = TestUtil_Rnd() % 4 == 0;
+
+        radius = (uint16_t)(5 + TestUtil_Rnd() % 76);
+        dsc.width = (lv_coord_t)(1 + TestUtil_Rnd() % radius);
+        center.x = (lv_coord_t)(TestUtil_Rnd() % (BUF_W + 40)) - 20;
+        center.y = (lv_coord_t)(TestUtil_Rnd() % (BUF_H + 40)) - 20;
+
+        /*Mostly the whole buffer, sometimes only a part of the arc is redrawn*/
+        if(TestUtil_Rnd() % 2) clip_area = buf_area;
+        else TestUtil_RandomArea(&clip_area, &buf_area);
+
+        draw_both(&dsc, &center, radius, (uint16_t)(TestUtil_Rnd() % 360), (uint16_t)(TestUtil_Rnd() % 360));
+    }
+}
+
+void test_circle_cache(void)
+{
+    lv_draw_arc_dsc_t dsc;
+    lv_point_t center = {BUF_W / 2, BUF_H / 2};
+
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.width = 10;
+    clip_area = buf_area;
+
+    /*A gauge with a changing value: the circles stay in the cache*/
+    draw(buf_fast, &dsc, &center, 60, 135, 45, false);
+    lv_port_cache_clear_stats();
+    draw(buf_fast, &dsc, &center, 60, 135, 200, false);
+    draw(buf_fast, &dsc, &center, 60, 135, 300, false);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_CIRCLE)->misses);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_CIRCLE)->hits);
+}
+
+void test_speed(void)
+{
+    lv_draw_arc_dsc_t dsc;
+
+    clip_area = buf_area;
+
+    TestUtil_PrintBenchHead("drawing", "quarters", "spans");
+
+    lv_draw_arc_dsc_init(&dsc);
+    dsc.color = lv_color_hex(0x3080C0);
+    dsc.width = 10;
+    print_bench("gauge 270 deg", &dsc, 70, 135, 45);
+    print_bench("value 90 deg", &dsc, 70, 135, 225);
+
+    dsc.rounded = 1;
+    print_bench("rounded value", &dsc, 70, 135, 225);
+
+    dsc.rounded = 0;
+    dsc.width = 3;
+    print_bench("thin gauge", &dsc, 70, 135, 45);
+
+    dsc.width = 25;
+    print_bench("thick arc", &dsc, 50, 180, 0);
+}
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+    lv_port_disp_init();
+    /*The blend functions and the circle cache get the display from here*/
+    _lv_refr_set_disp_refreshing(lv_disp_get_default());
+
+    UNITY_BEGIN();
+    RUN_TEST(test_arc);
+    RUN_TEST(test_circle_cache);
+    RUN_TEST(test_speed);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Draw with the spans into buf_fast and line by line into buf_ref, compare the pixels
+ */
+static void draw_both(const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
+                      uint16_t start, uint16_t end)
+{
+    TestUtil_RandomBg(buf_ref, BUF_W * BUF_H);
+    lv_memcpy(buf_fast, buf_ref, sizeof(buf_ref));
+
+    draw(buf_ref, dsc, center, radius, start, end, true);
+    draw(buf_fast, dsc, center, radius, start, end, false);
+
+    TEST_ASSERT_EQUAL_HEX16_ARRAY((const uint16_t *)buf_ref, (const uint16_t *)buf_fast, BUF_W * BUF_H);
+}
+
+/**
+ * Draw an arc into a buffer
+ * @param line_by_line  true: with a mask outside of the buffer, it makes LVGL draw every line with the masks
+ */
+static void draw(lv_color_t * buf, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
+                 uint16_t start, uint16_t end, bool line_by_line)
+{
+    TestUtil_LineByLine(line_by_line);
+
+    ctx.base_draw.buf = buf;
+    lv_draw_arc(&ctx.base_draw, dsc, center, radius, start, end);
+
+    TestUtil_LineByLine(false);
+}
+
+/**
+ * Draw into buf_fast in the middle of the buffer with the current setting of the spans, for TestUtil_Bench()
+ */
+static void bench_cb(void * user_data)
+{
+    const bench_t * b = user_data;
+    lv_point_t center = {BUF_W / 2, BUF_H / 2};
+
+    draw(buf_fast, b->dsc, &center, b->radius, b->start, b->end, false);
+}
+
+static void print_bench(const char * name, const lv_draw_arc_dsc_t * dsc, uint16_t radius, uint16_t start,
+                        uint16_t end)
+{
+    bench_t b = {dsc, radius, start, end};
+    char row[32];
+
+    lv_draw_sw_arc_spans_enable(false);
+    uint32_t quarters_ns = TestUtil_Bench(bench_cb, &b, BENCH_RUNS);
+    lv_draw_sw_arc_spans_enable(true);
+    uint32_t spans_ns = TestUtil_Bench(bench_cb, &b, BENCH_RUNS);
+
+    lv_snprintf(row, sizeof(row), "%-16s r%-3u w%-3d", name, (unsigned)radius, dsc->width);
+    TestUtil_PrintBench(row, quarters_ns, spans_ns);
+}
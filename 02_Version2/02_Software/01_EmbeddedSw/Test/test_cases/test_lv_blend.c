@@ -0,0 +1,294 @@
+/**
+ * @file test_lv_blend.c
+ *
+ * The blending of lv_port_blend.c against lv_draw_sw_blend_basic() of LVGL.
+ * Random colors, images, masks, opacities and areas (odd sizes and offsets for the word
+ * accesses) have to give the same pixels. Prints the host time of both for typical cases.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_blend.h"
+#include "Perf.h"
+#include "TestUtil.h"
+#include "unity/unity.h"
+#include <stdio.h>
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The draw buffer: a stripe of the panel*/
+#define BUF_W           LCD_PANEL_HEIGHT
+#define BUF_H           24
+
+/*Random blendings per test*/
+#define RUNS            3000
+
+/*Blendings per measurement*/
+#define BENCH_RUNS      200
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef void (*blend_cb_t)(lv_draw_ctx_t * draw_ctx, const lv_draw_sw_blend_dsc_t * dsc);
+
+typedef struct {
+    blend_cb_t blend;
+    const lv_draw_sw_blend_dsc_t * dsc;
+} bench_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void random_blend(bool image, lv_blend_mode_t blend_mode);
+static void blend_both(const lv_draw_sw_blend_dsc_t * dsc);
+static void bench_cb(void * user_data);
+static void print_bench(const char * name, const lv_draw_sw_blend_dsc_t * dsc);
+static lv_opa_t random_opa(void);
+static void random_mask(lv_opa_t * mask, uint32_t size);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_draw_sw_ctx_t ctx;
+static lv_area_t buf_area;
+static lv_area_t clip_area;
+
+static lv_color_t buf_ref[BUF_W * BUF_H];
+static lv_color_t buf_port[BUF_W * BUF_H];
+static lv_color_t src[BUF_W * BUF_H];
+static lv_opa_t mask_ref[BUF_W * BUF_H];
+static lv_opa_t mask_port[BUF_W * BUF_H];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_draw_sw_init_ctx(lv_disp_get_default()->driver, &ctx.base_draw);
+    ctx.base_draw.buf_area = &buf_area;
+    ctx.base_draw.clip_area = &clip_area;
+}
+
+void tearDown(void)
+{
+}
+
+void test_fill(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < RUNS; i++) random_blend(false, LV_BLEND_MODE_NORMAL);
+}
+
+void test_map(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < RUNS; i++) random_blend(true, LV_BLEND_MODE_NORMAL);
+}
+
+void test_other_blend_modes(void)
+{
+    uint32_t i;
+
+    /*Passed to LVGL*/
+    for(i = 0; i < RUNS / 10; i++) {
+        random_blend(false, LV_BLEND_MODE_ADDITIVE);
+        random_blend(true, LV_BLEND_MODE_MULTIPLY);
+    }
+}
+
+void test_speed(void)
+{
+    lv_draw_sw_blend_dsc_t dsc;
+    uint32_t i;
+
+    lv_area_set(&buf_area, 0, 0, BUF_W - 1, BUF_H - 1);
+    clip_area = buf_area;
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        src[i].full = (uint16_t)TestUtil_Rnd();
+        /*Letters: mostly transparent or covering, anti-aliased edges*/
+        uint32_t r = TestUtil_Rnd() % 8;
+        mask_port[i] = r < 4 ? LV_OPA_TRANSP : r < 6 ? LV_OPA_COVER : (lv_opa_t)TestUtil_Rnd();
+    }
+
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = &buf_area;
+    dsc.mask_area = &buf_area;
+    dsc.color = lv_color_hex(0x3080C0);
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+
+    char title[32];
+    lv_snprintf(title, sizeof(title), "blending %dx%d px", BUF_W, BUF_H);
+    TestUtil_PrintBenchHead(title, "LVGL", "port");
+
+    dsc.opa = LV_OPA_COVER;
+    print_bench("fill", &dsc);
+
+    dsc.mask_buf = mask_port;
+    dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+    print_bench("fill, mask", &dsc);
+
+    dsc.opa = LV_OPA_50;
+    print_bench("fill, mask, opa", &dsc);
+
+    dsc.src_buf = src;
+    print_bench("image, mask, opa", &dsc);
+
+    dsc.opa = LV_OPA_COVER;
+    print_bench("image, mask", &dsc);
+
+    dsc.mask_buf = NULL;
+    dsc.opa = LV_OPA_50;
+    print_bench("image, opa", &dsc);
+}
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+    lv_port_disp_init();
+    /*The blend functions get the display from here*/
+    _lv_refr_set_disp_refreshing(lv_disp_get_default());
+
+    UNITY_BEGIN();
+    RUN_TEST(test_fill);
+    RUN_TEST(test_map);
+    RUN_TEST(test_other_blend_modes);
+    RUN_TEST(test_speed);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Blend a random color or image with random areas, opacity and mask
+ */
+static void random_blend(bool image, lv_blend_mode_t blend_mode)
+{
+    lv_draw_sw_blend_dsc_t dsc;
+    lv_area_t blend_area;
+    lv_area_t all;
+    uint32_t i;
+
+    /*A draw buffer at an odd place of the screen, the clip area inside it*/
+    lv_area_set(&all, 0, 0, BUF_W - 1, BUF_H - 1);
+    TestUtil_RandomArea(&buf_area, &all);
+    lv_area_move(&buf_area, (lv_coord_t)(TestUtil_Rnd() % 5), (lv_coord_t)(TestUtil_Rnd() % 5));
+    TestUtil_RandomArea(&clip_area, &buf_area);
+
+    /*The blend area around the clip area*/
+    lv_area_set(&all, buf_area.x1 - 3, buf_area.y1 - 3, buf_area.x2 + 3, buf_area.y2 + 3);
+    TestUtil_RandomArea(&blend_area, &all);
+
+    for(i = 0; i < BUF_W * BUF_H; i++) {
+        buf_ref[i].full = (uint16_t)(TestUtil_Rnd() % 4 ? 0x1234 : TestUtil_Rnd());
+        src[i].full = (uint16_t)TestUtil_Rnd();
+    }
+    random_mask(mask_ref, lv_area_get_size(&blend_area));
+
+    lv_memset_00(&dsc, sizeof(dsc));
+    dsc.blend_area = &blend_area;
+    dsc.src_buf = image ? src : NULL;
+    dsc.color.full = (uint16_t)TestUtil_Rnd();
+    dsc.opa = random_opa();
+    dsc.blend_mode = blend_mode;
+    switch(TestUtil_Rnd() % 5) {
+        case 0:
+            dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+            break;
+        case 1:
+            dsc.mask_res = LV_DRAW_MASK_RES_TRANSP;
+            break;
+        default:
+            dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            break;
+    }
+    if(TestUtil_Rnd() % 4) {
+        dsc.mask_buf = mask_port;
+        dsc.mask_area = &blend_area;
+    }
+
+    blend_both(&dsc);
+}
+
+/**
+ * Blend with LVGL into buf_ref and with the port into buf_port, compare the pixels
+ */
+static void blend_both(const lv_draw_sw_blend_dsc_t * dsc)
+{
+    lv_draw_sw_blend_dsc_t dsc_ref = *dsc;
+
+    lv_memcpy(buf_port, buf_ref, sizeof(buf_ref));
+    lv_memcpy(mask_port, mask_ref, sizeof(mask_ref));
+    if(dsc->mask_buf) dsc_ref.mask_buf = mask_ref;
+
+    ctx.base_draw.buf = buf_ref;
+    lv_draw_sw_blend_basic(&ctx.base_draw, &dsc_ref);
+    ctx.base_draw.buf = buf_port;
+    lv_port_blend(&ctx.base_draw, dsc);
+
+    TEST_ASSERT_EQUAL_HEX16_ARRAY((const uint16_t *)buf_ref, (const uint16_t *)buf_port, BUF_W * BUF_H);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(mask_ref, mask_port, BUF_W * BUF_H);
+}
+
+/**
+ * Blend into the cleared buf_port, for TestUtil_Bench()
+ */
+static void bench_cb(void * user_data)
+{
+    const bench_t * b = user_data;
+
+    lv_memset_00(buf_port, sizeof(buf_port));
+    b->blend(&ctx.base_draw, b->dsc);
+}
+
+static void print_bench(const char * name, const lv_draw_sw_blend_dsc_t * dsc)
+{
+    bench_t basic = {lv_draw_sw_blend_basic, dsc};
+    bench_t port = {lv_port_blend, dsc};
+
+    ctx.base_draw.buf = buf_port;
+    uint32_t basic_ns = TestUtil_Bench(bench_cb, &basic, BENCH_RUNS);
+    uint32_t port_ns = TestUtil_Bench(bench_cb, &port, BENCH_RUNS);
+
+    TestUtil_PrintBench(name, basic_ns, port_ns);
+}
+
+/**
+ * An opacity around the thresholds of LVGL or a random one
+ */
+static lv_opa_t random_opa(void)
+{
+    static const lv_opa_t opas[] = {LV_OPA_MIN + 1, LV_OPA_50, LV_OPA_MAX - 1, LV_OPA_MAX, LV_OPA_MAX + 1, LV_OPA_COVER};
+
+    if(TestUtil_Rnd() % 2) return opas[TestUtil_Rnd() % (sizeof(opas) / sizeof(opas[0]))];
+    return (lv_opa_t)(LV_OPA_MIN + 1 + TestUtil_Rnd() % (LV_OPA_COVER - LV_OPA_MIN));
+}
+
+/**
+ * Runs of transparent and covering words and random values
+ */
+static void random_mask(lv_opa_t * mask, uint32_t size)
+{
+    uint32_t i = 0;
+
+    while(i < size) {
+        uint32_t run = 1 + TestUtil_Rnd() % 9;
+        uint32_t kind = TestUtil_Rnd() % 4;
+        for(; run && i < size; run--, i++) {
+            if(kind == 0) mask[i] = LV_OPA_TRANSP;
+            else if(kind == 1) mask[i] = LV_OPA_COVER;
+            else if(kind == 2) mask[i] = (lv_opa_t)(LV_OPA_MAX - 2 + TestUtil_Rnd() % 5);
+            else mask[i] = (lv_opa_t)TestUtil_Rnd();
+        }
+    }
+}
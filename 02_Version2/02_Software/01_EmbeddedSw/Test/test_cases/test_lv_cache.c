@@ -0,0 +1,347 @@
+/**
+ * @file test_lv_cache.c
+ *
+ * The caches of the LVGL draw engine (sizes in lv_conf.h, statistics in lv_port_cache.c)
+ * with the screens of the firmware. Prints the hits and misses of a steady frame and
+ * checks that a pre-warmed screen opens or computes nothing again. The letters drawn from
+ * the glyph cache have to look as without the cache (reference image), so have to the
+ * labels drawn with the lines of their layout cache. The styles of the objects have to give
+ * the same properties after every kind of change as without the style cache.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_cache.h"
+#include "lvgl/src/draw/sw/lv_draw_sw.h"
+#include "SettingsScreen.h"
+#include "SolderingScreen.h"
+#include "TrendScreen.h"
+#include "LcdEmu.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void full_frame(void);
+static lv_obj_t * glyph_label(lv_obj_t * parent, lv_coord_t y, lv_opa_t opa);
+static void print_stats(const char * name);
+static void check_no_miss(void);
+static bool ee_read(uint16_t addr, uint16_t * value);
+static bool ee_write(uint16_t addr, uint16_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const char * const cache_names[_LV_PORT_CACHE_NUM] = {"image", "gradient", "circle", "shadow", "corner", "glyph", "layout", "style"};
+
+static const Settings_Storage_t storage = {ee_read, ee_write};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_obj_clean(lv_scr_act());
+}
+
+void tearDown(void)
+{
+}
+
+void test_soldering_digits(void)
+{
+    SolderingModel_t model = {
+        .SetPoint = 320,
+        .ActiveSetPoint = 320,
+        .TipTemperature = 25,
+        .HeatingPower = 100,
+        .State = SOLDERING_STATE_HEATING,
+    };
+    uint32_t i;
+
+    SolderingModel_Update(&model);
+    SolderingScreen_Create(lv_scr_act());
+    lv_port_cache_prewarm(lv_scr_act());
+    lv_port_cache_clear_stats();
+
+    /*Heating up: every digit of the tip temperature is shown, none is opened again*/
+    for(i = 0; i < 40; i++) {
+        model.TipTemperature = (uint16_t)(25 + i * 8);
+        model.HeatingPower = (uint8_t)(100 - i * 2);
+        SolderingModel_Update(&model);
+        lv_refr_now(NULL);
+    }
+
+    print_stats("soldering, heating up");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_IMG)->hits);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_IMG)->misses);
+}
+
+void test_soldering_steady(void)
+{
+    SolderingScreen_Create(lv_scr_act());
+    lv_port_cache_prewarm(lv_scr_act());
+    full_frame();
+    check_no_miss();
+    print_stats("soldering");
+}
+
+void test_trend_steady(void)
+{
+    uint32_t i;
+
+    TempTrend_Clear();
+    for(i = 0; i < 600; i++) TempTrend_Add((uint16_t)(200 + i % 150));
+    TrendScreen_Create(lv_scr_act());
+    lv_port_cache_prewarm(lv_scr_act());
+    full_frame();
+    check_no_miss();
+    print_stats("trend");
+}
+
+void test_settings_steady(void)
+{
+    SettingsScreen_Create(lv_scr_act());
+    lv_port_cache_prewarm(lv_scr_act());
+    full_frame();
+    check_no_miss();
+    print_stats("settings");
+}
+
+void test_prewarm_gradient(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 200, 20);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00FF00), 0);
+    lv_obj_set_style_bg_grad_color(obj, lv_color_hex(0xFF0000), 0);
+    lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_HOR, 0);
+    lv_obj_update_layout(obj);
+
+    lv_port_cache_clear_stats();
+    lv_port_cache_prewarm(lv_scr_act());
+    TEST_ASSERT_EQUAL_UINT32(1, lv_port_cache_get_stats(LV_PORT_CACHE_GRAD)->misses);
+
+    /*The first frame finds the map in the cache*/
+    lv_port_cache_clear_stats();
+    lv_refr_now(NULL);
+    print_stats("gradient");
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_GRAD)->hits);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_GRAD)->misses);
+}
+
+void test_glyph_pixels(void)
+{
+    uint32_t i;
+
+    /*Opaque and semi transparent letters, clipped by the screen and by rounded corners*/
+    lv_obj_set_style_bg_color(lv_scr_act(), lv_color_hex(0x204060), 0);
+    glyph_label(lv_scr_act(), 4, LV_OPA_COVER);
+    glyph_label(lv_scr_act(), 30, LV_OPA_70);
+    lv_obj_set_x(glyph_label(lv_scr_act(), 56, LV_OPA_MAX - 1), -7);
+    lv_obj_set_y(glyph_label(lv_scr_act(), 0, LV_OPA_COVER), LV_VER_RES - 9);
+
+    lv_obj_t * box = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(box);
+    lv_obj_set_pos(box, 20, 90);
+    lv_obj_set_size(box, 200, 60);
+    lv_obj_set_style_radius(box, 25, 0);
+    lv_obj_set_style_clip_corner(box, true, 0);
+    lv_obj_set_style_bg_opa(box, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(box, lv_color_hex(0xE0E0E0), 0);
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * label = glyph_label(box, (lv_coord_t)(i * 20 - 2), i == 1 ? LV_OPA_50 : LV_OPA_COVER);
+        lv_obj_set_style_text_color(label, lv_color_hex(0x802010), 0);
+    }
+
+    /*Every letter is expanded in the first frame and drawn from the cache in the second*/
+    lv_draw_sw_glyph_cache_clear();
+    lv_refr_now(NULL);
+    lv_port_cache_clear_stats();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    print_stats("glyphs");
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_GLYPH)->misses);
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("glyphs")));
+
+    lv_obj_remove_local_style_prop(lv_scr_act(), LV_STYLE_BG_COLOR, 0);
+}
+
+void test_label_layout(void)
+{
+    static const lv_text_align_t aligns[] = {LV_TEXT_ALIGN_LEFT, LV_TEXT_ALIGN_CENTER, LV_TEXT_ALIGN_RIGHT};
+    uint32_t i;
+
+    /*Wrapped lines (more than the layout stores), new lines, recoloring and a single line number*/
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * label = lv_label_create(lv_scr_act());
+        lv_label_set_text_static(label, "Heating the tip\nto the #FF0000 set point# of the station, then sleep");
+        lv_label_set_recolor(label, i == 1);
+        lv_obj_set_style_text_align(label, aligns[i], 0);
+        lv_obj_set_width(label, 100);
+        lv_obj_set_pos(label, (lv_coord_t)(i * 105 + 5), 10);
+    }
+
+    lv_obj_t * temp = lv_label_create(lv_scr_act());
+    lv_obj_set_style_text_font(temp, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_align(temp, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_width(temp, 80);
+    lv_obj_set_pos(temp, 5, 150);
+    lv_label_set_text_fmt(temp, "%d", 315);
+
+    full_frame();
+    print_stats("labels");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("label_layout")));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_LAYOUT)->hits);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_LAYOUT)->misses);
+
+    /*A new value is laid out once, its size and its drawing use the same layout*/
+    lv_port_cache_clear_stats();
+    lv_label_set_text_fmt(temp, "%d", 28);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_port_cache_get_stats(LV_PORT_CACHE_LAYOUT)->misses);
+}
+
+void test_style_props(void)
+{
+    static lv_style_t style;
+    lv_obj_t * obj = lv_obj_create(lv_scr_act());
+    lv_obj_t * child = lv_label_create(obj);
+
+    lv_obj_remove_style_all(obj);
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0x102030));
+    lv_obj_add_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_HEX16(lv_color_hex(0x102030).full, lv_obj_get_style_bg_color(obj, 0).full);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_outline_width(obj, 0));
+
+    /*Only the collection of the properties is counted: the lookups of a steady object hit*/
+    lv_port_cache_clear_stats();
+    lv_obj_get_style_outline_width(obj, 0);
+    lv_obj_get_style_bg_color(obj, 0);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_port_cache_get_stats(LV_PORT_CACHE_STYLE)->hits);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_STYLE)->misses);
+
+    /*New properties of a shared style, reported or not*/
+    lv_style_set_outline_width(&style, 3);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_outline_width(obj, 0));
+    lv_style_set_radius(&style, 5);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_radius(obj, 0));
+
+    /*Inherited from the parent*/
+    lv_style_set_text_color(&style, lv_color_hex(0xFF0000));
+    TEST_ASSERT_EQUAL_HEX16(lv_color_hex(0xFF0000).full, lv_obj_get_style_text_color(child, 0).full);
+
+    /*Local properties, properties of an other state and of an other part*/
+    lv_obj_set_style_pad_top(obj, 7, 0);
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_pad_top(obj, 0));
+    lv_obj_set_style_border_width(obj, 4, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_border_width(obj, 0));
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(4, lv_obj_get_style_border_width(obj, 0));
+    lv_obj_set_style_shadow_width(obj, 6, LV_PART_SCROLLBAR);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_shadow_width(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(6, lv_obj_get_style_shadow_width(obj, LV_PART_SCROLLBAR));
+
+    /*Removed properties*/
+    lv_obj_remove_style(obj, &style, 0);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, 0));
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_PAD_TOP, 0);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_style_pad_bottom(obj, 0), lv_obj_get_style_pad_top(obj, 0));
+
+    lv_style_reset(&style);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+    Settings_Init(&storage, 0);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_soldering_digits);
+    RUN_TEST(test_soldering_steady);
+    RUN_TEST(test_trend_steady);
+    RUN_TEST(test_settings_steady);
+    RUN_TEST(test_prewarm_gradient);
+    RUN_TEST(test_glyph_pixels);
+    RUN_TEST(test_label_layout);
+    RUN_TEST(test_style_props);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Draw the first frame of the screen, then count the lookups of a second full frame
+ */
+static void full_frame(void)
+{
+    lv_refr_now(NULL);
+    lv_port_cache_clear_stats();
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+}
+
+/**
+ * A line of text with every kind of letter of the screens
+ */
+static lv_obj_t * glyph_label(lv_obj_t * parent, lv_coord_t y, lv_opa_t opa)
+{
+    lv_obj_t * label = lv_label_create(parent);
+    lv_label_set_text_static(label, "Tip: 315 C, 80% Wg");
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_20, 0);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xFFE080), 0);
+    lv_obj_set_style_text_opa(label, opa, 0);
+    lv_obj_set_pos(label, 2, y);
+    return label;
+}
+
+static void print_stats(const char * name)
+{
+    uint32_t i;
+
+    printf("%s:", name);
+    for(i = 0; i < _LV_PORT_CACHE_NUM; i++) {
+        const lv_port_cache_stats_t * s = lv_port_cache_get_stats(i);
+        printf(" %s %u/%u", cache_names[i], (unsigned)s->hits, (unsigned)(s->hits + s->misses));
+    }
+    printf(" (hits/lookups)\n");
+}
+
+static void check_no_miss(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < _LV_PORT_CACHE_NUM; i++) {
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, lv_port_cache_get_stats(i)->misses, cache_names[i]);
+    }
+}
+
+static bool ee_read(uint16_t addr, uint16_t * value)
+{
+    (void)addr;
+    (void)value;
+    return false;
+}
+
+static bool ee_write(uint16_t addr, uint16_t value)
+{
+    (void)addr;
+    (void)value;
+    return true;
+}
@@ -0,0 +1,394 @@
+/**
+ * @file test_lv_mem.c
+ *
+ * The memory of LVGL (lv_port_mem.c) with the screens of the firmware.
+ * Prints the peak usage and the size classes (the base of LV_MEM_SIZE in lv_conf.h)
+ * and checks that the statistics and the walk of the pool agree.
+ * The slabs (LV_PORT_MEM_SLAB) have to keep the animations and timers out of TLSF:
+ * prints the host time of starting and ending them.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_mem.h"
+#include "SettingsScreen.h"
+#include "SolderingScreen.h"
+#include "TrendScreen.h"
+#include "Perf.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Free memory to keep at the peak of the firmware screens*/
+#define MEM_MARGIN      (LV_MEM_SIZE / 4)
+
+/*Allocations of the size classes <= 128 and <= 1024*/
+#define SIZE_SMALL      100
+#define SIZE_LARGE      1000
+#define CLASS_SMALL     3
+#define CLASS_LARGE     6
+
+/*Animations and timers started and ended at once, and the rounds of it*/
+#define CHURN_NUM       16
+#define CHURN_ROUNDS    500
+
+/*The slabs of the event descriptors in LV_PORT_MEM_SLAB_SIZES*/
+#define SLAB_EVENT_DSC1 2
+#define SLAB_EVENT_DSC2 3
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool ee_read(uint16_t addr, uint16_t * value);
+static bool ee_write(uint16_t addr, uint16_t value);
+static uint32_t class_used(void);
+static void print_stats(void);
+static uint32_t churn(lv_obj_t * objs[], uint32_t rounds);
+static void anim_exec_cb(void * var, int32_t v);
+static void timer_cb(lv_timer_t * timer);
+static void event_cb(lv_event_t * e);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const Settings_Storage_t storage = {ee_read, ee_write};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_firmware_screens(void)
+{
+    lv_obj_t * scr_act = lv_scr_act();
+    uint32_t i;
+
+    lv_port_mem_clear_stats();
+
+    /*As the GUI task of freertos.c: every view exists all the time*/
+    for(i = 0; i < 600; i++) TempTrend_Add((uint16_t)(200 + i % 150));
+    lv_obj_t * soldering = SolderingScreen_Create(lv_obj_create(NULL));
+    lv_obj_t * trend = TrendScreen_Create(lv_obj_create(NULL));
+    lv_obj_t * settings = SettingsScreen_Create(lv_obj_create(NULL));
+
+    lv_scr_load(lv_obj_get_screen(soldering));
+    lv_refr_now(NULL);
+    lv_scr_load(lv_obj_get_screen(trend));
+    TrendScreen_SetWindow(TREND_SCREEN_WINDOW_LONG);
+    lv_refr_now(NULL);
+    lv_scr_load(lv_obj_get_screen(settings));
+    lv_refr_now(NULL);
+
+    print_stats();
+
+    const lv_port_mem_stats_t * stats = lv_port_mem_get_stats();
+    TEST_ASSERT_EQUAL_UINT32(0, stats->fails);
+    TEST_ASSERT_LESS_THAN_UINT32(LV_MEM_SIZE - MEM_MARGIN, stats->max_used);
+
+    lv_scr_load(scr_act);
+    lv_obj_del(lv_obj_get_screen(soldering));
+    lv_obj_del(lv_obj_get_screen(trend));
+    lv_obj_del(lv_obj_get_screen(settings));
+}
+
+void test_free(void)
+{
+    uint32_t used;
+    uint32_t blocks;
+    uint32_t i;
+
+    /*The screen keeps the list of its children: allocate it first*/
+    lv_obj_del(lv_obj_create(lv_scr_act()));
+    used = lv_port_mem_get_stats()->cur_used;
+    blocks = class_used();
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    for(i = 0; i < 20; i++) lv_label_set_text_fmt(lv_label_create(cont), "Label %d", (int)i);
+    TEST_ASSERT_GREATER_THAN_UINT32(used, lv_port_mem_get_stats()->cur_used);
+    TEST_ASSERT_GREATER_THAN_UINT32(blocks, class_used());
+
+    lv_obj_del(cont);
+    TEST_ASSERT_EQUAL_UINT32(used, lv_port_mem_get_stats()->cur_used);
+    TEST_ASSERT_EQUAL_UINT32(blocks, class_used());
+}
+
+void test_realloc(void)
+{
+    const lv_port_mem_class_t * classes = lv_port_mem_get_stats()->classes;
+    uint32_t used = lv_port_mem_get_stats()->cur_used;
+    uint32_t small = classes[CLASS_SMALL].used;
+    uint32_t large = classes[CLASS_LARGE].used;
+
+    uint8_t * p = lv_mem_alloc(SIZE_SMALL);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL_UINT32(small + 1, classes[CLASS_SMALL].used);
+    p[SIZE_SMALL - 1] = 0x5A;
+
+    p = lv_mem_realloc(p, SIZE_LARGE);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL_UINT8(0x5A, p[SIZE_SMALL - 1]);
+    TEST_ASSERT_EQUAL_UINT32(small, classes[CLASS_SMALL].used);
+    TEST_ASSERT_EQUAL_UINT32(large + 1, classes[CLASS_LARGE].used);
+
+    lv_mem_free(p);
+    TEST_ASSERT_EQUAL_UINT32(used, lv_port_mem_get_stats()->cur_used);
+
+    /*Larger than the pool*/
+    TEST_ASSERT_NULL(lv_mem_alloc(LV_MEM_SIZE));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_port_mem_get_stats()->fails);
+}
+
+void test_report(void)
+{
+    lv_port_mem_report_t report;
+    lv_mem_monitor_t mon;
+    uint32_t free_blocks = 0;
+    uint32_t i;
+
+    lv_port_mem_report(&report);
+    lv_mem_monitor(&mon);
+
+    /*The walk finds the blocks the statistics count*/
+    TEST_ASSERT_EQUAL_UINT32(class_used(), report.used_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_MEM_SIZE - lv_port_mem_get_stats()->cur_used, report.free_size);
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) free_blocks += report.free_blocks[i];
+    TEST_ASSERT_EQUAL_UINT32(report.free_cnt, free_blocks);
+
+    /*lv_mem_monitor() is served by the port*/
+    TEST_ASSERT_EQUAL_UINT32(LV_MEM_SIZE, mon.total_size);
+    TEST_ASSERT_EQUAL_UINT32(report.free_size + report.slab_free_size, mon.free_size);
+    TEST_ASSERT_EQUAL_UINT32(report.free_biggest_size, mon.free_biggest_size);
+    TEST_ASSERT_EQUAL_UINT32(lv_port_mem_get_stats()->max_used, mon.max_used);
+}
+
+#if LV_PORT_MEM_SLAB
+void test_slab(void)
+{
+    const lv_port_mem_stats_t * stats = lv_port_mem_get_stats();
+    const lv_port_mem_slab_t * dsc1 = &stats->slabs[SLAB_EVENT_DSC1];
+    const lv_port_mem_slab_t * dsc2 = &stats->slabs[SLAB_EVENT_DSC2];
+    uint8_t * blocks[64];
+    uint32_t used = stats->cur_used;
+    uint32_t i;
+    uint32_t j;
+
+    /*Every size, from the slabs or TLSF, keeps its data*/
+    for(i = 0; i < 64; i++) {
+        blocks[i] = lv_mem_alloc(i * 5 + 1);
+        TEST_ASSERT_NOT_NULL(blocks[i]);
+        lv_memset(blocks[i], (uint8_t)i, i * 5 + 1);
+    }
+    for(i = 0; i < 64; i += 2) lv_mem_free(blocks[i]);
+    for(i = 1; i < 64; i += 2) {
+        for(j = 0; j < i * 5 + 1; j++) TEST_ASSERT_EQUAL_UINT8(i, blocks[i][j]);
+        lv_mem_free(blocks[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT32(used, stats->cur_used);
+
+    /*Stays in the block while it fits, else moved to an other slab with the data*/
+    uint32_t used1 = dsc1->used;
+    uint8_t * p = lv_mem_alloc(3 * sizeof(void *));
+    TEST_ASSERT_EQUAL_UINT32(used1 + 1, dsc1->used);
+    lv_memset(p, 0x5A, 3 * sizeof(void *));
+    TEST_ASSERT_EQUAL_PTR(p, lv_mem_realloc(p, 2 * sizeof(void *) + 1));
+    p = lv_mem_realloc(p, 6 * sizeof(void *));
+    TEST_ASSERT_EQUAL_UINT32(used1, dsc1->used);
+    for(i = 0; i < 2 * sizeof(void *) + 1; i++) TEST_ASSERT_EQUAL_UINT8(0x5A, p[i]);
+    lv_mem_free(p);
+    TEST_ASSERT_EQUAL_UINT32(used, stats->cur_used);
+
+    /*Many blocks: more pages, kept when empty till they are trimmed*/
+    lv_port_mem_trim();
+    uint32_t pages = dsc2->pages;
+    for(i = 0; i < 64; i++) blocks[i] = lv_mem_alloc(6 * sizeof(void *));
+    TEST_ASSERT_GREATER_THAN_UINT32(pages, dsc2->pages);
+    uint32_t pages_max = dsc2->pages;
+    for(i = 0; i < 64; i++) lv_mem_free(blocks[i]);
+    TEST_ASSERT_EQUAL_UINT32(pages_max, dsc2->pages);
+    TEST_ASSERT_EQUAL_UINT32(pages_max - pages, lv_port_mem_trim());
+    TEST_ASSERT_EQUAL_UINT32(pages, dsc2->pages);
+    TEST_ASSERT_EQUAL_UINT32(used, stats->cur_used);
+}
+
+void test_slab_churn(void)
+{
+    const lv_port_mem_stats_t * stats = lv_port_mem_get_stats();
+    lv_port_mem_report_t before;
+    lv_port_mem_report_t after;
+    uint32_t i;
+
+    lv_obj_t * cont = lv_obj_create(lv_scr_act());
+    lv_obj_t * objs[CHURN_NUM];
+    for(i = 0; i < CHURN_NUM; i++) objs[i] = lv_obj_create(cont);
+    /*The slabs take their pages in the first round*/
+    churn(objs, 1);
+    lv_port_mem_clear_stats();
+    lv_port_mem_report(&before);
+
+    uint32_t us = churn(objs, CHURN_ROUNDS);
+    lv_port_mem_report(&after);
+
+    /*In the steady state the slabs don't take pages and TLSF isn't touched*/
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, stats->slabs[i].fallbacks);
+        TEST_ASSERT_EQUAL_UINT32(0, stats->slabs[i].page_allocs);
+    }
+    TEST_ASSERT_EQUAL_UINT32(before.free_cnt, after.free_cnt);
+    TEST_ASSERT_EQUAL_UINT32(before.free_biggest_size, after.free_biggest_size);
+    /*Every allocation was served by a slab*/
+    uint32_t allocs = 0;
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) allocs += stats->classes[i].allocs;
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) allocs -= stats->slabs[i].allocs;
+    TEST_ASSERT_EQUAL_UINT32(0, allocs);
+
+    printf("%d animations, timers and events started and ended: %u us (host)\n", CHURN_NUM, (unsigned)(us / CHURN_ROUNDS));
+    print_stats();
+
+    lv_obj_del(cont);
+}
+#endif /*LV_PORT_MEM_SLAB*/
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+    lv_port_disp_init();
+    Settings_Init(&storage, 0);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_firmware_screens);
+    RUN_TEST(test_free);
+    RUN_TEST(test_realloc);
+    RUN_TEST(test_report);
+#if LV_PORT_MEM_SLAB
+    RUN_TEST(test_slab);
+    RUN_TEST(test_slab_churn);
+#endif
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool ee_read(uint16_t addr, uint16_t * value)
+{
+    (void)addr;
+    (void)value;
+    return false;
+}
+
+static bool ee_write(uint16_t addr, uint16_t value)
+{
+    (void)addr;
+    (void)value;
+    return true;
+}
+
+/**
+ * Get the number of blocks in use according to the statistics
+ */
+static uint32_t class_used(void)
+{
+    const lv_port_mem_stats_t * stats = lv_port_mem_get_stats();
+    uint32_t n = 0;
+    uint32_t i;
+
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) n += stats->classes[i].used;
+    return n;
+}
+
+static void print_stats(void)
+{
+    const lv_port_mem_stats_t * stats = lv_port_mem_get_stats();
+    lv_port_mem_report_t report;
+    uint32_t limit = LV_PORT_MEM_CLASS_MIN;
+    uint32_t i;
+
+    lv_port_mem_report(&report);
+
+    printf("LVGL memory: %u / %u bytes used, peak %u, %u blocks, %u free blocks, biggest free %u, frag %u%%\n",
+           (unsigned)stats->cur_used, (unsigned)report.total_size, (unsigned)stats->max_used,
+           (unsigned)report.used_cnt, (unsigned)report.free_cnt, (unsigned)report.free_biggest_size,
+           (unsigned)report.frag_pct);
+    printf("  size class   allocs   used   peak   free blocks\n");
+    for(i = 0; i < LV_PORT_MEM_CLASS_NUM; i++) {
+        if(i < LV_PORT_MEM_CLASS_NUM - 1) printf("  <= %5u", (unsigned)limit);
+        else printf("   > %5u", (unsigned)(limit / 2));
+        printf("  %9u  %5u  %5u  %12u\n", (unsigned)stats->classes[i].allocs, (unsigned)stats->classes[i].used,
+               (unsigned)stats->classes[i].peak, (unsigned)report.free_blocks[i]);
+        limit <<= 1;
+    }
+
+#if LV_PORT_MEM_SLAB
+    printf("  slab  pages  page allocs   allocs   used   peak  fallbacks   (%u bytes free)\n",
+           (unsigned)report.slab_free_size);
+    for(i = 0; i < LV_PORT_MEM_SLAB_NUM; i++) {
+        const lv_port_mem_slab_t * slab = &stats->slabs[i];
+        printf("  %4u  %5u  %11u  %7u  %5u  %5u  %9u\n", (unsigned)slab->size, (unsigned)slab->pages,
+               (unsigned)slab->page_allocs, (unsigned)slab->allocs, (unsigned)slab->used, (unsigned)slab->peak,
+               (unsigned)slab->fallbacks);
+    }
+#endif
+}
+
+/**
+ * Start and end animations, timers and event callbacks of objects as the screens do
+ * @return  [us] the time of all rounds
+ */
+static uint32_t churn(lv_obj_t * objs[], uint32_t rounds)
+{
+    lv_timer_t * timers[CHURN_NUM];
+    uint32_t start = Perf_Now();
+    uint32_t r;
+    uint32_t i;
+
+    for(r = 0; r < rounds; r++) {
+        for(i = 0; i < CHURN_NUM; i++) {
+            lv_anim_t a;
+            lv_anim_init(&a);
+            lv_anim_set_var(&a, objs[i]);
+            lv_anim_set_exec_cb(&a, anim_exec_cb);
+            lv_anim_set_values(&a, 0, 100);
+            lv_anim_set_time(&a, 200);
+            lv_anim_start(&a);
+            timers[i] = lv_timer_create(timer_cb, 100, NULL);
+            lv_obj_add_event_cb(objs[i], event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+        }
+        for(i = 0; i < CHURN_NUM; i++) {
+            lv_anim_del(objs[i], anim_exec_cb);
+            lv_timer_del(timers[i]);
+            lv_obj_remove_event_cb(objs[i], event_cb);
+        }
+    }
+
+    return Perf_ToUs(Perf_Now() - start);
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    LV_UNUSED(var);
+    LV_UNUSED(v);
+}
+
+static void timer_cb(lv_timer_t * timer)
+{
+    LV_UNUSED(timer);
+}
+
+static void event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
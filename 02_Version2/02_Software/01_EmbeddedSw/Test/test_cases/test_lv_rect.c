@@ -0,0 +1,290 @@
+/**
+ * @file test_lv_rect.c
+ *
+ * The fast paths of lv_draw_sw_rect.c: plain rectangles, borders as four fills and the rounded corners
+ * from the corner cache (LV_RECT_CORNER_CACHE_SIZE in lv_conf.h).
+ * Random opaque rectangles have to give the same pixels as the line by line drawing of LVGL, which is
+ * used when an other mask is active (with opacity the two ways of LVGL round differently).
+ * Translucent borders have to give the same pixels as without the corner cache.
+ * Prints the host time of the rounded boxes and bars of the screens without and with the corner cache.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "lv_port_blend.h"
+#include "lv_port_cache.h"
+#include "Perf.h"
+#include "TestUtil.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*The draw buffer: a stripe of the panel*/
+#define BUF_W           LCD_PANEL_HEIGHT
+#define BUF_H           60
+
+/*Random rectangles per test*/
+#define RUNS            2000
+
+/*Drawings per measurement*/
+#define BENCH_RUNS      200
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    const lv_draw_rect_dsc_t * dsc;
+    const lv_area_t * coords;
+} bench_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void random_rect(lv_draw_rect_dsc_t * dsc, lv_area_t * coords);
+static void draw_both(const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords, bool line_by_line);
+static void draw(lv_color_t * buf, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords, bool line_by_line,
+                 bool cache);
+static void bench_cb(void * user_data);
+static void print_bench(const char * name, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static lv_draw_sw_ctx_t ctx;
+static lv_area_t buf_area;
+static lv_area_t clip_area;
+
+static lv_color_t buf_ref[BUF_W * BUF_H];
+static lv_color_t buf_fast[BUF_W * BUF_H];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_port_blend_ctx_init(lv_disp_get_default()->driver, &ctx.base_draw);
+    lv_area_set(&buf_area, 0, 0, BUF_W - 1, BUF_H - 1);
+    ctx.base_draw.buf_area = &buf_area;
+    ctx.base_draw.clip_area = &clip_area;
+}
+
+void tearDown(void)
+{
+}
+
+void test_bg(void)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t coords;
+    uint32_t i;
+
+    for(i = 0; i < RUNS; i++) {
+        random_rect(&dsc, &coords);
+        draw_both(&dsc, &coords, true);
+    }
+}
+
+void test_border(void)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t coords;
+    uint32_t i;
+
+    for(i = 0; i < RUNS; i++) {
+        random_rect(&dsc, &coords);
+        dsc.border_color.full = (uint16_t)TestUtil_Rnd();
+        /*Wider than the half of the rectangle, LVGL draws outside of it without masks*/
+        lv_coord_t short_side = LV_MIN(lv_area_get_width(&coords), lv_area_get_height(&coords));
+        dsc.border_width = (lv_coord_t)(1 + TestUtil_Rnd() % 8);
+        dsc.border_width = LV_MIN(dsc.border_width, (short_side - 1) / 2);
+        if(TestUtil_Rnd() % 4 == 0) {
+            dsc.outline_color.full = (uint16_t)TestUtil_Rnd();
+            dsc.outline_width = (lv_coord_t)(1 + TestUtil_Rnd() % 4);
+            dsc.outline_pad = (lv_coord_t)(TestUtil_Rnd() % 3);
+            dsc.outline_opa = LV_OPA_COVER;
+        }
+        draw_both(&dsc, &coords, true);
+    }
+}
+
+void test_translucent_border(void)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t coords;
+    uint32_t i;
+
+    lv_port_cache_clear_stats();
+    for(i = 0; i < RUNS; i++) {
+        random_rect(&dsc, &coords);
+        /*Mostly wider than the split limit of lv_draw_sw_rect.c: the corners from the cache*/
+        if(TestUtil_Rnd() % 4) {
+            coords.x1 = LV_MIN(coords.x1, BUF_W / 2 - 40);
+            coords.x2 = LV_MAX(coords.x2, BUF_W / 2 + 40);
+        }
+        dsc.bg_opa = LV_OPA_TRANSP;
+        dsc.border_color.full = (uint16_t)TestUtil_Rnd();
+        dsc.border_opa = (lv_opa_t)(LV_OPA_MIN + 1 + TestUtil_Rnd() % (LV_OPA_MAX - LV_OPA_MIN - 1));
+        lv_coord_t short_side = LV_MIN(lv_area_get_width(&coords), lv_area_get_height(&coords));
+        dsc.border_width = (lv_coord_t)(1 + TestUtil_Rnd() % 8);
+        dsc.border_width = LV_MIN(dsc.border_width, (short_side - 1) / 2);
+        draw_both(&dsc, &coords, false);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_CORNER)->hits);
+}
+
+void test_corner_cache(void)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t coords;
+
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.radius = 6;
+    dsc.border_width = 2;
+    lv_area_set(&coords, 10, 10, 109, 49);
+    clip_area = buf_area;
+
+    /*The background and the border have their own corners*/
+    draw(buf_fast, &dsc, &coords, false, true);
+    lv_port_cache_clear_stats();
+    draw(buf_fast, &dsc, &coords, false, true);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_port_cache_get_stats(LV_PORT_CACHE_CORNER)->hits);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_CORNER)->misses);
+
+    /*Larger than the cached corners*/
+    dsc.radius = LV_RADIUS_CIRCLE;
+    draw(buf_fast, &dsc, &coords, false, true);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_port_cache_get_stats(LV_PORT_CACHE_CORNER)->misses);
+}
+
+void test_speed(void)
+{
+    lv_draw_rect_dsc_t dsc;
+    lv_area_t panel;
+    lv_area_t bar;
+
+    lv_area_set(&panel, 4, 2, BUF_W - 5, BUF_H - 3);
+    lv_area_set(&bar, 20, 20, BUF_W - 21, 31);
+    clip_area = buf_area;
+
+    TestUtil_PrintBenchHead("drawing", "no cache", "corner cache");
+
+    lv_draw_rect_dsc_init(&dsc);
+    dsc.bg_color = lv_color_hex(0x3080C0);
+    dsc.radius = LV_RADIUS_CIRCLE;
+    print_bench("rounded bar", &dsc, &bar);
+
+    dsc.radius = 8;
+    print_bench("rounded panel", &dsc, &panel);
+
+    dsc.bg_opa = LV_OPA_TRANSP;
+    dsc.border_width = 2;
+    print_bench("rounded border", &dsc, &panel);
+
+    dsc.border_opa = LV_OPA_50;
+    print_bench("rounded border, opa", &dsc, &panel);
+}
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+    lv_port_disp_init();
+    /*The blend functions and the corner cache get the display from here*/
+    _lv_refr_set_disp_refreshing(lv_disp_get_default());
+
+    UNITY_BEGIN();
+    RUN_TEST(test_bg);
+    RUN_TEST(test_border);
+    RUN_TEST(test_translucent_border);
+    RUN_TEST(test_corner_cache);
+    RUN_TEST(test_speed);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * A random opaque background around the draw buffer with small and large radii,
+ * a random clip area in the buffer
+ */
+static void random_rect(lv_draw_rect_dsc_t * dsc, lv_area_t * coords)
+{
+    static const lv_coord_t radii[] = {0, 1, 2, 3, 5, 8, 12, 16, 17, 30, LV_RADIUS_CIRCLE};
+    lv_area_t all;
+
+    lv_area_set(&all, -10, -10, BUF_W + 9, BUF_H + 9);
+    TestUtil_RandomArea(coords, &all);
+    TestUtil_RandomArea(&clip_area, &buf_area);
+
+    lv_draw_rect_dsc_init(dsc);
+    dsc->bg_color.full = (uint16_t)TestUtil_Rnd();
+    dsc->bg_opa = LV_OPA_COVER;
+    dsc->radius = radii[TestUtil_Rnd() % (sizeof(radii) / sizeof(radii[0]))];
+}
+
+/**
+ * Draw with the corner cache into buf_fast and the reference into buf_ref, compare the pixels
+ * @param line_by_line  true: the line by line drawing of LVGL is the reference, false: the drawing without
+ *                      the corner cache
+ */
+static void draw_both(const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords, bool line_by_line)
+{
+    TestUtil_RandomBg(buf_ref, BUF_W * BUF_H);
+    lv_memcpy(buf_fast, buf_ref, sizeof(buf_ref));
+
+    draw(buf_ref, dsc, coords, line_by_line, false);
+    draw(buf_fast, dsc, coords, false, true);
+
+    TEST_ASSERT_EQUAL_HEX16_ARRAY((const uint16_t *)buf_ref, (const uint16_t *)buf_fast, BUF_W * BUF_H);
+}
+
+/**
+ * Draw a rectangle into a buffer
+ * @param line_by_line  true: with a mask outside of the buffer, it makes LVGL draw every line with the masks
+ * @param cache         false: bypass the corner cache
+ */
+static void draw(lv_color_t * buf, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords, bool line_by_line,
+                 bool cache)
+{
+    TestUtil_LineByLine(line_by_line);
+    lv_draw_sw_rect_corner_cache_enable(cache);
+
+    ctx.base_draw.buf = buf;
+    lv_draw_rect(&ctx.base_draw, dsc, coords);
+
+    lv_draw_sw_rect_corner_cache_enable(true);
+    TestUtil_LineByLine(false);
+}
+
+/**
+ * Draw into buf_fast with the current setting of the corner cache, for TestUtil_Bench()
+ */
+static void bench_cb(void * user_data)
+{
+    const bench_t * b = user_data;
+
+    ctx.base_draw.buf = buf_fast;
+    lv_draw_rect(&ctx.base_draw, b->dsc, b->coords);
+}
+
+static void print_bench(const char * name, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords)
+{
+    bench_t b = {dsc, coords};
+    char row[32];
+
+    lv_draw_sw_rect_corner_cache_enable(false);
+    uint32_t no_cache_ns = TestUtil_Bench(bench_cb, &b, BENCH_RUNS);
+    lv_draw_sw_rect_corner_cache_enable(true);
+    uint32_t cache_ns = TestUtil_Bench(bench_cb, &b, BENCH_RUNS);
+
+    lv_snprintf(row, sizeof(row), "%-20s %3dx%-3d", name, lv_area_get_width(coords), lv_area_get_height(coords));
+    TestUtil_PrintBench(row, no_cache_ns, cache_ns);
+}
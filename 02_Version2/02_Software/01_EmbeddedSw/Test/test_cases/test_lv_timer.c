@@ -0,0 +1,343 @@
+/**
+ * @file test_lv_timer.c
+ *
+ * The timers of LVGL in the heap (LV_TIMER_HEAP in lv_conf.h).
+ * Every call of lv_timer_handler() has to run exactly the ready timers, once each, and return the
+ * time till the next one, as the scan of the list does. Random timers are created, deleted, paused,
+ * resumed and changed between the calls and from the callbacks.
+ * Prints the host time of a call with many timers.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lvgl.h"
+#include "Perf.h"
+#include "TestUtil.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Timers of the random test*/
+#define TIMER_NUM       64
+
+/*Calls of lv_timer_handler() in the random test*/
+#define STEPS           5000
+
+/*Timers and calls of the measurement*/
+#define BENCH_TIMERS    200
+#define BENCH_CALLS     2000
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_timer_t * timer;
+    uint32_t runs;
+    bool ready;         /*can run in the call of lv_timer_handler()*/
+} timer_info_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void count_cb(lv_timer_t * timer);
+static void random_cb(lv_timer_t * timer);
+static void random_change(void);
+static void check_handler(void);
+static uint32_t time_till_next(void);
+static uint32_t remaining(lv_timer_t * timer);
+static bool exists(lv_timer_t * timer);
+static void del_all(void);
+static void bench_cb(void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static timer_info_t infos[TIMER_NUM];
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_memset_00(infos, sizeof(infos));
+}
+
+void tearDown(void)
+{
+    del_all();
+}
+
+void test_periods(void)
+{
+    static const uint32_t periods[] = {1, 7, 30, 100};
+    uint32_t i;
+
+    for(i = 0; i < 4; i++) infos[i].timer = lv_timer_create(count_cb, periods[i], &infos[i]);
+
+    for(i = 0; i < 1000; i++) {
+        lv_tick_inc(1);
+        TEST_ASSERT_EQUAL_UINT32(time_till_next(), lv_timer_handler());
+    }
+
+    for(i = 0; i < 4; i++) TEST_ASSERT_EQUAL_UINT32(1000 / periods[i], infos[i].runs);
+}
+
+void test_pause_ready_repeat(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < 3; i++) infos[i].timer = lv_timer_create(count_cb, 50, &infos[i]);
+
+    /*Paused: not run, not waited for*/
+    lv_timer_pause(infos[0].timer);
+    lv_timer_pause(infos[0].timer);
+    lv_tick_inc(10);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_handler());
+
+    /*Made ready: runs in the next call*/
+    lv_timer_ready(infos[1].timer);
+    TEST_ASSERT_EQUAL_UINT32(40, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, infos[1].runs);
+
+    /*Resumed twice: once in the heap, late by 10 ms*/
+    lv_timer_resume(infos[0].timer);
+    lv_timer_resume(infos[0].timer);
+    lv_tick_inc(40);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, infos[0].runs);
+    TEST_ASSERT_EQUAL_UINT32(1, infos[2].runs);
+
+    /*One shot: deleted after its run*/
+    lv_timer_set_repeat_count(infos[2].timer, 1);
+    lv_tick_inc(50);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, infos[2].runs);
+    TEST_ASSERT_NULL(infos[2].timer);
+
+    /*No repeat left: deleted in the next call without running*/
+    lv_timer_set_repeat_count(infos[0].timer, 0);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(2, infos[0].runs);
+    TEST_ASSERT_FALSE(exists(infos[0].timer));
+    infos[0].timer = NULL;
+    TEST_ASSERT_EQUAL_UINT32(time_till_next(), lv_timer_handler());
+}
+
+void test_zero_period(void)
+{
+    infos[0].timer = lv_timer_create(count_cb, 0, &infos[0]);
+    infos[1].timer = lv_timer_create(count_cb, 5, &infos[1]);
+
+    /*Ready all the time but once per call, the other timer runs too*/
+    lv_tick_inc(5);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, infos[0].runs);
+    TEST_ASSERT_EQUAL_UINT32(1, infos[1].runs);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(2, infos[0].runs);
+    TEST_ASSERT_EQUAL_UINT32(1, infos[1].runs);
+}
+
+void test_random(void)
+{
+    uint32_t i;
+
+    for(i = 0; i < TIMER_NUM; i++) {
+        if(TestUtil_Rnd() % 2) infos[i].timer = lv_timer_create(random_cb, TestUtil_Rnd() % 50 + 1, &infos[i]);
+    }
+
+    for(i = 0; i < STEPS; i++) {
+        random_change();
+        lv_tick_inc(TestUtil_Rnd() % 8);
+        check_handler();
+    }
+}
+
+void test_speed(void)
+{
+    uint32_t i;
+
+    /*A frame period and a slow blink as on the screens*/
+    for(i = 0; i < BENCH_TIMERS; i++) lv_timer_create(count_cb, i % 2 ? 30 : 500, NULL);
+
+    printf("lv_timer_handler() with %d timers: %u ns per call (host)\n", BENCH_TIMERS,
+           (unsigned)TestUtil_Bench(bench_cb, NULL, BENCH_CALLS));
+}
+
+int main(void)
+{
+    Perf_Init();
+    lv_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_periods);
+    RUN_TEST(test_pause_ready_repeat);
+    RUN_TEST(test_zero_period);
+    RUN_TEST(test_random);
+    RUN_TEST(test_speed);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void count_cb(lv_timer_t * timer)
+{
+    timer_info_t * info = timer->user_data;
+    if(info == NULL) return;
+
+    info->runs++;
+    /*The last run of a one shot timer: LVGL deletes it*/
+    if(timer->repeat_count == 0) info->timer = NULL;
+}
+
+/**
+ * Count the run and change some timers as a callback can do
+ */
+static void random_cb(lv_timer_t * timer)
+{
+    timer_info_t * info = timer->user_data;
+
+    TEST_ASSERT_TRUE_MESSAGE(info->ready, "a timer ran before its time");
+    info->runs++;
+    if(TestUtil_Rnd() % 8 == 0) random_change();
+}
+
+/**
+ * Create, delete, pause, resume or change a random timer
+ */
+static void random_change(void)
+{
+    timer_info_t * info = &infos[TestUtil_Rnd() % TIMER_NUM];
+
+    /*Can be ready now, also in a callback*/
+    info->ready = true;
+
+    if(info->timer == NULL) {
+        info->timer = lv_timer_create(random_cb, TestUtil_Rnd() % 50, info);
+        return;
+    }
+
+    switch(TestUtil_Rnd() % 6) {
+        case 0:
+            lv_timer_del(info->timer);
+            info->timer = NULL;
+            break;
+        case 1:
+            lv_timer_pause(info->timer);
+            break;
+        case 2:
+            lv_timer_resume(info->timer);
+            break;
+        case 3:
+            lv_timer_set_period(info->timer, TestUtil_Rnd() % 50 + 1);
+            break;
+        case 4:
+            lv_timer_reset(info->timer);
+            break;
+        default:
+            lv_timer_ready(info->timer);
+            break;
+    }
+}
+
+/**
+ * Call lv_timer_handler() and check the timers which ran and the returned time.
+ * The callbacks can change the timers: only the ones not touched by them are checked.
+ */
+static void check_handler(void)
+{
+    uint32_t runs[TIMER_NUM];
+    lv_timer_t * timers[TIMER_NUM];
+    bool ready[TIMER_NUM];
+    uint32_t i;
+
+    for(i = 0; i < TIMER_NUM; i++) {
+        timers[i] = infos[i].timer;
+        runs[i] = infos[i].runs;
+        ready[i] = timers[i] && !timers[i]->paused && remaining(timers[i]) == 0;
+        infos[i].ready = ready[i];
+    }
+
+    uint32_t res = lv_timer_handler();
+
+    bool changed = false;
+    for(i = 0; i < TIMER_NUM; i++) {
+        if(infos[i].timer != timers[i]) {
+            changed = true;
+            continue;
+        }
+        if(timers[i] == NULL) continue;
+        /*At most once per call*/
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(runs[i] + 1, infos[i].runs);
+        if(ready[i] && !timers[i]->paused && infos[i].runs == runs[i]) {
+            /*Paused or made ready again by an other callback*/
+            if(remaining(timers[i]) != 0 || timers[i]->last_run == lv_tick_get()) continue;
+            TEST_FAIL_MESSAGE("a ready timer didn't run");
+        }
+    }
+
+    if(!changed) TEST_ASSERT_EQUAL_UINT32(time_till_next(), res);
+}
+
+/**
+ * The time till the next timer from the list of the timers
+ */
+static uint32_t time_till_next(void)
+{
+    uint32_t t = LV_NO_TIMER_READY;
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+
+    while(timer) {
+        if(!timer->paused && remaining(timer) < t) t = remaining(timer);
+        timer = lv_timer_get_next(timer);
+    }
+
+    return t;
+}
+
+static uint32_t remaining(lv_timer_t * timer)
+{
+    uint32_t elaps = lv_tick_elaps(timer->last_run);
+    return elaps >= timer->period ? 0 : timer->period - elaps;
+}
+
+static bool exists(lv_timer_t * timer)
+{
+    lv_timer_t * t = lv_timer_get_next(NULL);
+
+    while(t && t != timer) t = lv_timer_get_next(t);
+
+    return t != NULL;
+}
+
+/**
+ * Delete the timers of the test, keep the ones of LVGL
+ */
+static void del_all(void)
+{
+    lv_timer_t * timer = lv_timer_get_next(NULL);
+
+    while(timer) {
+        lv_timer_t * next = lv_timer_get_next(timer);
+        if(timer->timer_cb == count_cb || timer->timer_cb == random_cb) lv_timer_del(timer);
+        timer = next;
+    }
+}
+
+/**
+ * A tick and a call of lv_timer_handler(), for TestUtil_Bench()
+ */
+static void bench_cb(void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_tick_inc(1);
+    lv_timer_handler();
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_settings.c
+ *
+ * The settings store (Settings.c) on a RAM model of the EEPROM emulation and the
+ * LVGL settings screen (SettingsScreen.c) drawn on the ILI9341 model.
+ * Checks that the changes reach the flash only when settled and only if they differ.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "SettingsScreen.h"
+#include "LcdEmu.h"
+#include "unity/unity.h"
+#include <string.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+#define T0              1000
+#define ADDR_NUM        0x10
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool ee_read(uint16_t addr, uint16_t * value);
+static bool ee_write(uint16_t addr, uint16_t value);
+static void key(lv_obj_t * obj, uint32_t k);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint16_t ee[ADDR_NUM];
+static bool ee_stored[ADDR_NUM];
+static uint32_t ee_writes;
+static bool ee_fail;
+
+static const Settings_Storage_t storage = {ee_read, ee_write};
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    memset(ee, 0, sizeof(ee));
+    memset(ee_stored, 0, sizeof(ee_stored));
+    ee_writes = 0;
+    ee_fail = false;
+    Settings_Init(&storage, T0);
+    Settings_ClearStats();
+}
+
+void tearDown(void)
+{
+}
+
+void test_defaults(void)
+{
+    TEST_ASSERT_EQUAL_INT32(100, Settings_Get(SETTINGS_SETPOINT));
+    TEST_ASSERT_EQUAL_INT32(170, Settings_Get(SETTINGS_KP));
+    TEST_ASSERT_EQUAL_INT32(150, Settings_Get(SETTINGS_SLEEP_TEMPERATURE));
+    TEST_ASSERT_FALSE(Settings_IsDirty());
+
+    /*The defaults are not written*/
+    TEST_ASSERT_TRUE(Settings_Handler(T0 + 10 * SETTINGS_FLUSH_DELAY));
+    TEST_ASSERT_EQUAL_UINT32(0, ee_writes);
+}
+
+void test_load(void)
+{
+    /*The setpoint in 10 °C units as the earlier firmware stored it*/
+    ee[0x0001] = 32;
+    ee_stored[0x0001] = true;
+    /*Out of range: the default is used*/
+    ee[0x0005] = 99;
+    ee_stored[0x0005] = true;
+    /*Negative*/
+    ee[0x000D] = (uint16_t) -3;
+    ee_stored[0x000D] = true;
+
+    Settings_Init(&storage, T0);
+    TEST_ASSERT_EQUAL_INT32(320, Settings_Get(SETTINGS_SETPOINT));
+    TEST_ASSERT_EQUAL_INT32(250, Settings_Get(SETTINGS_PRESET_1));
+    TEST_ASSERT_EQUAL_INT32(-3, Settings_Get(SETTINGS_CAL_OFFSET_1 + 1));
+}
+
+void test_clamp(void)
+{
+    int32_t min;
+    int32_t max;
+
+    TEST_ASSERT_TRUE(Settings_Set(SETTINGS_SETPOINT, 1000));
+    TEST_ASSERT_EQUAL_INT32(450, Settings_Get(SETTINGS_SETPOINT));
+    TEST_ASSERT_TRUE(Settings_Set(SETTINGS_SETPOINT, 324));
+    TEST_ASSERT_EQUAL_INT32(320, Settings_Get(SETTINGS_SETPOINT));
+    TEST_ASSERT_FALSE(Settings_Set(SETTINGS_SETPOINT, 318));
+    TEST_ASSERT_TRUE(Settings_Set(SETTINGS_CAL_OFFSET_1, -80));
+    TEST_ASSERT_EQUAL_INT32(-50, Settings_Get(SETTINGS_CAL_OFFSET_1));
+
+    Settings_GetRange(SETTINGS_TIP_TYPE, &min, &max);
+    TEST_ASSERT_EQUAL_INT32(0, min);
+    TEST_ASSERT_EQUAL_INT32(SETTINGS_TIP_NUM - 1, max);
+}
+
+void test_write_behind(void)
+{
+    uint32_t t;
+
+    /*Turning the encoder: a change every 100 ms*/
+    for(t = T0; t < T0 + 2000; t += 100) {
+        Settings_Handler(t);
+        Settings_Set(SETTINGS_SETPOINT, 100 + (t - T0) / 10);
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, ee_writes);
+    TEST_ASSERT_TRUE(Settings_IsDirty());
+
+    /*Settled*/
+    for(; t < T0 + 2000 + 2 * SETTINGS_FLUSH_DELAY; t += 100) Settings_Handler(t);
+    TEST_ASSERT_EQUAL_UINT32(1, ee_writes);
+    TEST_ASSERT_EQUAL_UINT16(29, ee[0x0001]);
+    TEST_ASSERT_FALSE(Settings_IsDirty());
+}
+
+void test_back_to_stored(void)
+{
+    uint32_t t = T0;
+
+    /*Switching through the presets and back to the stored setpoint*/
+    Settings_Set(SETTINGS_SETPOINT, Settings_Get(SETTINGS_PRESET_1));
+    Settings_Handler(t += 500);
+    Settings_Set(SETTINGS_SETPOINT, Settings_Get(SETTINGS_PRESET_1 + 1));
+    Settings_Handler(t += 500);
+    Settings_Set(SETTINGS_SETPOINT, 100);
+    Settings_Handler(t += SETTINGS_FLUSH_DELAY);
+
+    TEST_ASSERT_EQUAL_UINT32(0, ee_writes);
+    TEST_ASSERT_EQUAL_UINT32(1, Settings_GetStats()->skipped);
+}
+
+void test_write_error(void)
+{
+    ee_fail = true;
+    Settings_Set(SETTINGS_SLEEP_DELAY, 30);
+    TEST_ASSERT_FALSE(Settings_Handler(T0 + SETTINGS_FLUSH_DELAY));
+    TEST_ASSERT_EQUAL_UINT32(1, Settings_GetStats()->errors);
+    TEST_ASSERT_TRUE(Settings_IsDirty());
+
+    /*Retried a delay later*/
+    ee_fail = false;
+    TEST_ASSERT_TRUE(Settings_Handler(T0 + SETTINGS_FLUSH_DELAY + 100));
+    TEST_ASSERT_EQUAL_UINT32(0, ee_writes);
+    TEST_ASSERT_TRUE(Settings_Handler(T0 + 2 * SETTINGS_FLUSH_DELAY));
+    TEST_ASSERT_EQUAL_UINT32(1, ee_writes);
+    TEST_ASSERT_EQUAL_UINT16(30, ee[0x0009]);
+}
+
+void test_flush(void)
+{
+    Settings_Set(SETTINGS_PRESET_1, 300);
+    Settings_Set(SETTINGS_CAL_OFFSET_1 + 2, -7);
+    TEST_ASSERT_TRUE(Settings_Flush());
+    TEST_ASSERT_EQUAL_UINT32(2, ee_writes);
+    TEST_ASSERT_EQUAL_UINT16(30, ee[0x0005]);
+    TEST_ASSERT_EQUAL_UINT16((uint16_t) -7, ee[0x000E]);
+
+    /*Read back*/
+    Settings_Init(&storage, T0);
+    TEST_ASSERT_EQUAL_INT32(300, Settings_Get(SETTINGS_PRESET_1));
+    TEST_ASSERT_EQUAL_INT32(-7, Settings_Get(SETTINGS_CAL_OFFSET_1 + 2));
+}
+
+void test_screen(void)
+{
+    lv_obj_clean(lv_scr_act());
+    SettingsScreen_Create(lv_scr_act());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("settings")));
+}
+
+void test_screen_keys(void)
+{
+    lv_obj_clean(lv_scr_act());
+    lv_obj_t * view = SettingsScreen_Create(lv_scr_act());
+    TEST_ASSERT_EQUAL(SETTINGS_PRESET_1, SettingsScreen_GetSelected());
+
+    /*Navigate, wrapping around*/
+    key(view, LV_KEY_RIGHT);
+    key(view, LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL(SETTINGS_PRESET_1 + 2, SettingsScreen_GetSelected());
+    key(view, LV_KEY_LEFT);
+    key(view, LV_KEY_LEFT);
+    key(view, LV_KEY_LEFT);
+    TEST_ASSERT_EQUAL(SETTINGS_PID_PROFILE, SettingsScreen_GetSelected());
+
+    /*Change the PID profile*/
+    lv_event_send(view, LV_EVENT_SHORT_CLICKED, NULL);
+    TEST_ASSERT_TRUE(SettingsScreen_IsEditing());
+    key(view, LV_KEY_RIGHT);
+    key(view, LV_KEY_RIGHT);
+    key(view, LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_INT32(SETTINGS_PID_PROFILE_NUM - 1, Settings_Get(SETTINGS_PID_PROFILE));
+    lv_event_send(view, LV_EVENT_SHORT_CLICKED, NULL);
+    TEST_ASSERT_FALSE(SettingsScreen_IsEditing());
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("settings_pid")));
+
+    /*Nothing is written until settled*/
+    TEST_ASSERT_EQUAL_UINT32(0, ee_writes);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_defaults);
+    RUN_TEST(test_load);
+    RUN_TEST(test_clamp);
+    RUN_TEST(test_write_behind);
+    RUN_TEST(test_back_to_stored);
+    RUN_TEST(test_write_error);
+    RUN_TEST(test_flush);
+    RUN_TEST(test_screen);
+    RUN_TEST(test_screen_keys);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool ee_read(uint16_t addr, uint16_t * value)
+{
+    if(addr >= ADDR_NUM || !ee_stored[addr]) return false;
+    *value = ee[addr];
+    return true;
+}
+
+static bool ee_write(uint16_t addr, uint16_t value)
+{
+    if(addr >= ADDR_NUM || ee_fail) return false;
+    ee[addr] = value;
+    ee_stored[addr] = true;
+    ee_writes++;
+    return true;
+}
+
+/**
+ * Send a key to the view as the encoder in edit mode does
+ */
+static void key(lv_obj_t * obj, uint32_t k)
+{
+    lv_event_send(obj, LV_EVENT_KEY, &k);
+}
@@ -0,0 +1,248 @@
+/**
+ * @file test_soldering_screen.c
+ *
+ * The LVGL soldering screen (SolderingScreen.c) following SolderingModel.c, drawn on the ILI9341 model.
+ * Checks the pictures of the states and that a frame redraws only the changed widgets.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "SolderingScreen.h"
+#include "LcdEmu.h"
+#include "DigitSprites.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+/*A digit cell of the screen: one sprite of DigitSprites.c*/
+#define DIGIT_AREA      (DIGIT_SPRITE_W * DIGIT_SPRITE_H)
+
+/*A pixel on the left segments of the last tip digit*/
+#define TIP_DIGIT_PX_X  217
+#define TIP_DIGIT_PX_Y  111
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void frame(const char * name);
+static void check_only(SolderingScreen_Widget_t widget, uint32_t area);
+static void observer_cb(uint32_t changed, const SolderingModel_t * model, void * user_data);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static const SolderingModel_t heating = {
+    .SetPoint = 320,
+    .ActiveSetPoint = 320,
+    .TipTemperature = 315,
+    .HeatingPower = 40,
+    .State = SOLDERING_STATE_HEATING,
+};
+
+static uint32_t observer_changed;
+static uint32_t observer_calls;
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    lv_obj_clean(lv_scr_act());
+    SolderingModel_Update(&heating);
+    SolderingScreen_Create(lv_scr_act());
+    lv_refr_now(NULL);
+    LcdEmu_ClearStats();
+    SolderingScreen_ClearStats();
+}
+
+void tearDown(void)
+{
+}
+
+void test_model_changes(void)
+{
+    SolderingModel_t m = heating;
+
+    TEST_ASSERT_TRUE(SolderingModel_AddObserver(observer_cb, &observer_calls));
+
+    observer_calls = 0;
+    TEST_ASSERT_EQUAL_HEX32(0, SolderingModel_Update(&m));
+    TEST_ASSERT_EQUAL_UINT32(0, observer_calls);
+
+    m.TipTemperature = 320;
+    m.Blink = true;
+    TEST_ASSERT_EQUAL_HEX32(SOLDERING_MODEL_TIP_TEMPERATURE | SOLDERING_MODEL_BLINK, SolderingModel_Update(&m));
+    TEST_ASSERT_EQUAL_UINT32(1, observer_calls);
+    TEST_ASSERT_EQUAL_HEX32(SOLDERING_MODEL_TIP_TEMPERATURE | SOLDERING_MODEL_BLINK, observer_changed);
+    TEST_ASSERT_EQUAL_UINT16(320, SolderingModel_Get()->TipTemperature);
+
+    SolderingModel_RemoveObserver(observer_cb, &observer_calls);
+    m.State = SOLDERING_STATE_SLEEP;
+    TEST_ASSERT_EQUAL_HEX32(SOLDERING_MODEL_STATE, SolderingModel_Update(&m));
+    TEST_ASSERT_EQUAL_UINT32(1, observer_calls);
+}
+
+void test_heating(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    frame("heating");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("soldering_heating")));
+}
+
+void test_sleep(void)
+{
+    SolderingModel_t m = heating;
+    m.ActiveSetPoint = 150;
+    m.State = SOLDERING_STATE_SLEEP;
+    m.InHolder = true;
+    SolderingModel_Update(&m);
+    frame("sleep");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("soldering_sleep")));
+
+    /*The setpoint blinks in, only the caption and the changed digits are redrawn*/
+    m.Blink = true;
+    SolderingModel_Update(&m);
+    frame("sleep blink");
+    TEST_ASSERT_EQUAL_UINT32(2 * DIGIT_AREA, SolderingScreen_GetStats(SOLDERING_SCREEN_SETPOINT)->area);
+    TEST_ASSERT_NOT_EQUAL(0, SolderingScreen_GetStats(SOLDERING_SCREEN_CAPTION)->draws);
+    TEST_ASSERT_EQUAL_UINT32(0, SolderingScreen_GetStats(SOLDERING_SCREEN_TIP)->draws);
+}
+
+void test_tip_removed(void)
+{
+    SolderingModel_t m = heating;
+    m.State = SOLDERING_STATE_TIP_REMOVED;
+    m.Blink = true;
+    SolderingModel_Update(&m);
+    frame("tip removed");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("soldering_tip_removed")));
+    TEST_ASSERT_NOT_EQUAL(0x0000, LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, TIP_DIGIT_PX_X, TIP_DIGIT_PX_Y));
+
+    /*Blinking hides the tip temperature (only the background is drawn there) and clears the banner*/
+    m.Blink = false;
+    SolderingModel_Update(&m);
+    frame("tip blink");
+    TEST_ASSERT_EQUAL_UINT32(0, SolderingScreen_GetStats(SOLDERING_SCREEN_TIP)->draws);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, TIP_DIGIT_PX_X, TIP_DIGIT_PX_Y));
+    TEST_ASSERT_EQUAL_HEX16(0x0000, LcdEmu_GetPixel(LCD_EMU_VIEW_LANDSCAPE, 160, 220));
+}
+
+void test_one_digit(void)
+{
+    SolderingModel_t m = heating;
+    m.TipTemperature = 310;
+    SolderingModel_Update(&m);
+    frame("one digit");
+
+    /*Only the last digit of the tip temperature goes to the panel*/
+    TEST_ASSERT_EQUAL_UINT32(DIGIT_AREA, LcdEmu_GetStats()->pixels);
+    check_only(SOLDERING_SCREEN_TIP, DIGIT_AREA);
+}
+
+void test_power(void)
+{
+    SolderingModel_t m = heating;
+    m.HeatingPower = 50;
+    SolderingModel_Update(&m);
+    frame("power");
+    check_only(SOLDERING_SCREEN_POWER, 300 * 24);
+}
+
+void test_steady_state(void)
+{
+    SolderingModel_t m = heating;
+
+    /*Blinking matters only in the holder and on errors*/
+    m.Blink = true;
+    SolderingModel_Update(&m);
+    m.SetPointEdited = true;
+    SolderingModel_Update(&m);
+    frame("steady");
+
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->commands);
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->data_bytes);
+    check_only(_SOLDERING_SCREEN_WIDGET_NUM, 0);
+}
+
+void test_holder(void)
+{
+    SolderingModel_t m = heating;
+    m.InHolder = true;
+    SolderingModel_Update(&m);
+    frame("holder");
+    check_only(SOLDERING_SCREEN_HOLDER, 100 * 18);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_model_changes);
+    RUN_TEST(test_heating);
+    RUN_TEST(test_sleep);
+    RUN_TEST(test_tip_removed);
+    RUN_TEST(test_one_digit);
+    RUN_TEST(test_power);
+    RUN_TEST(test_steady_state);
+    RUN_TEST(test_holder);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Refresh the screen and print what it has cost
+ */
+static void frame(const char * name)
+{
+    SolderingScreen_Widget_t w;
+    uint32_t area = 0;
+    uint32_t time_us = 0;
+
+    LcdEmu_ClearStats();
+    SolderingScreen_ClearStats();
+    lv_refr_now(NULL);
+
+    for(w = 0; w < _SOLDERING_SCREEN_WIDGET_NUM; w++) {
+        area += SolderingScreen_GetStats(w)->area;
+        time_us += SolderingScreen_GetStats(w)->time_us;
+    }
+    printf("%-12s pixels: %6u, widget area: %6u, widget time: %5u us\n", name,
+           (unsigned)LcdEmu_GetStats()->pixels, (unsigned)area, (unsigned)time_us);
+}
+
+/**
+ * Check that only `widget` has been redrawn and exactly `area` of it
+ */
+static void check_only(SolderingScreen_Widget_t widget, uint32_t area)
+{
+    SolderingScreen_Widget_t w;
+    for(w = 0; w < _SOLDERING_SCREEN_WIDGET_NUM; w++) {
+        const SolderingScreen_Stats_t * s = SolderingScreen_GetStats(w);
+        if(w == widget) {
+            TEST_ASSERT_EQUAL_UINT32(area, s->area);
+        }
+        else {
+            TEST_ASSERT_EQUAL_UINT32(0, s->draws);
+        }
+    }
+}
+
+static void observer_cb(uint32_t changed, const SolderingModel_t * model, void * user_data)
+{
+    (void)model;
+    observer_changed = changed;
+    (*(uint32_t *)user_data)++;
+}
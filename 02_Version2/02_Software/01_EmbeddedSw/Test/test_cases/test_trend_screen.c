@@ -0,0 +1,177 @@
+/**
+ * @file test_trend_screen.c
+ *
+ * The tip temperature history (TempTrend.c) and the LVGL trend screen (TrendScreen.c) drawn on the ILI9341 model.
+ * Checks the min/max decimation, the pictures of the windows and that a new column redraws only a narrow strip.
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_port_disp.h"
+#include "TrendScreen.h"
+#include "LcdEmu.h"
+#include "unity/unity.h"
+#include <stdio.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define REF_IMG(name)   REF_IMGS_DIR "/" name ".png"
+
+#define HISTORY         (TREND_SCREEN_COLUMNS * TEMP_TREND_BUCKET + 5)
+
+/*A new column with the sweep gap after it: a few pixel wide strip of the plot*/
+#define COLUMN_AREA_MAX (8 * 200)
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint16_t history(uint32_t i);
+static void frame(const char * name);
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void setUp(void)
+{
+    uint32_t i;
+
+    lv_obj_clean(lv_scr_act());
+    TempTrend_Clear();
+    for(i = 0; i < HISTORY; i++) TempTrend_Add(history(i));
+    TrendScreen_Create(lv_scr_act());
+    lv_refr_now(NULL);
+    LcdEmu_ClearStats();
+    TrendScreen_ClearStats();
+}
+
+void tearDown(void)
+{
+}
+
+void test_ring_buffers(void)
+{
+    TempTrend_MinMax_t mm;
+    uint32_t i;
+
+    TempTrend_Clear();
+    for(i = 0; i < 40; i++) TempTrend_Add((uint16_t)(100 + (i * 7) % 23));
+    TEST_ASSERT_EQUAL_UINT32(40, TempTrend_GetCount());
+
+    TEST_ASSERT_TRUE(TempTrend_Get(3, 1, &mm));
+    TEST_ASSERT_EQUAL_UINT16(121, mm.min);
+    TEST_ASSERT_EQUAL_UINT16(121, mm.max);
+
+    /*A bucket and a part of it from the samples*/
+    TEST_ASSERT_TRUE(TempTrend_Get(16, 16, &mm));
+    TEST_ASSERT_EQUAL_UINT16(100, mm.min);
+    TEST_ASSERT_EQUAL_UINT16(121, mm.max);
+    TEST_ASSERT_TRUE(TempTrend_Get(24, 8, &mm));
+    TEST_ASSERT_EQUAL_UINT16(103, mm.min);
+    TEST_ASSERT_EQUAL_UINT16(121, mm.max);
+
+    /*Not measured yet*/
+    TEST_ASSERT_FALSE(TempTrend_Get(32, 16, &mm));
+    TEST_ASSERT_FALSE(TempTrend_Get(40, 1, &mm));
+    TEST_ASSERT_FALSE(TempTrend_Get(0, 0, &mm));
+
+    /*The samples are overwritten, the buckets are kept longer*/
+    for(i = 40; i < TEMP_TREND_SAMPLES + 48; i++) TempTrend_Add((uint16_t)(100 + (i * 7) % 23));
+    TEST_ASSERT_FALSE(TempTrend_Get(1, 1, &mm));
+    TEST_ASSERT_TRUE(TempTrend_Get(0, 32, &mm));
+    TEST_ASSERT_EQUAL_UINT16(100, mm.min);
+    TEST_ASSERT_EQUAL_UINT16(122, mm.max);
+}
+
+void test_short_window(void)
+{
+    lv_obj_invalidate(lv_scr_act());
+    frame("short");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("trend_short")));
+}
+
+void test_long_window(void)
+{
+    TrendScreen_SetWindow(TREND_SCREEN_WINDOW_LONG);
+    TEST_ASSERT_EQUAL_INT(TREND_SCREEN_WINDOW_LONG, TrendScreen_GetWindow());
+    frame("long");
+    TEST_ASSERT_EQUAL_INT32(0, LcdEmu_ComparePng(LCD_EMU_VIEW_LANDSCAPE, REF_IMG("trend_long")));
+}
+
+void test_new_column(void)
+{
+    TempTrend_Add(history(HISTORY));
+    TrendScreen_Refresh();
+    frame("new column");
+    TEST_ASSERT_EQUAL_UINT32(1, TrendScreen_GetStats()->columns);
+    TEST_ASSERT_UINT32_WITHIN(COLUMN_AREA_MAX / 2, COLUMN_AREA_MAX / 2, TrendScreen_GetStats()->area);
+    TEST_ASSERT_EQUAL_UINT32(TrendScreen_GetStats()->area, LcdEmu_GetStats()->pixels);
+
+    /*In the long window a column needs a whole bucket*/
+    TrendScreen_SetWindow(TREND_SCREEN_WINDOW_LONG);
+    lv_refr_now(NULL);
+    TrendScreen_ClearStats();
+    TempTrend_Add(history(HISTORY + 1));
+    TrendScreen_Refresh();
+    frame("no column");
+    TEST_ASSERT_EQUAL_UINT32(0, TrendScreen_GetStats()->columns);
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->pixels);
+}
+
+void test_steady_state(void)
+{
+    TrendScreen_Refresh();
+    frame("steady");
+    TEST_ASSERT_EQUAL_UINT32(0, TrendScreen_GetStats()->columns);
+    TEST_ASSERT_EQUAL_UINT32(0, LcdEmu_GetStats()->commands);
+}
+
+int main(void)
+{
+    lv_init();
+    lv_port_disp_init();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_ring_buffers);
+    RUN_TEST(test_short_window);
+    RUN_TEST(test_long_window);
+    RUN_TEST(test_new_column);
+    RUN_TEST(test_steady_state);
+    return UNITY_END();
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Made up measurements: heating up to 320 °C, then a heavy joint every 1100 samples
+ * pulling the tip down by 80 °C and recovering, with a little noise
+ */
+static uint16_t history(uint32_t i)
+{
+    uint32_t t;
+    uint32_t joint = i % 1100;
+
+    if(i < 100) return (uint16_t)(25 + i * 295 / 100);
+
+    t = 320 + (i * 7) % 5;
+    if(joint >= 1000 && joint < 1010) t -= (joint - 1000) * 8;
+    else if(joint >= 1010 && joint < 1050) t -= 80 - (joint - 1010) * 2;
+    return (uint16_t)t;
+}
+
+/**
+ * Refresh the screen and print what it has cost
+ */
+static void frame(const char * name)
+{
+    LcdEmu_ClearStats();
+    lv_refr_now(NULL);
+    printf("%-12s pixels: %6u, chart area: %6u, chart time: %5u us\n", name,
+           (unsigned)LcdEmu_GetStats()->pixels, (unsigned)TrendScreen_GetStats()->area,
+           (unsigned)TrendScreen_GetStats()->time_us);
+}
@@ -19,6 +19,13 @@
 
 #include <stdint.h>
 
+/*1: benchmark build (the "Benchmark" configuration of the project defines it):
+ *the GUI task runs `lv_demo_benchmark()` instead of the station screens and the results are
+ *printed on USART2 (monitors, log and the demo are enabled below)*/
+#ifndef LV_PORT_BENCHMARK
+#define LV_PORT_BENCHMARK 0
+#endif
+
 /*====================
    COLOR SETTINGS
  *====================*/
@@ -26,8 +33,11 @@
 /*Color depth: 1 (1 byte per pixel), 8 (RGB332), 16 (RGB565), 32 (ARGB8888)*/
 #define LV_COLOR_DEPTH 16
 
-/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)*/
-#define LV_COLOR_16_SWAP 1
+/*Swap the 2 bytes of RGB565 color. Useful if the display has an 8-bit interface (e.g. SPI)
+ *Not needed for the ILI9341: its flush swaps the bytes while writing them to the bus*/
+#ifndef LV_COLOR_16_SWAP
+#define LV_COLOR_16_SWAP 0
+#endif
 
 /*Enable features to draw on transparent background.
  *It's required if opa, and transform_* style properties are used.
@@ -46,7 +56,7 @@
  *=========================*/
 
 /*1: use custom malloc/free, 0: use the built-in `lv_mem_alloc()` and `lv_mem_free()`*/
-#define LV_MEM_CUSTOM 0
+#define LV_MEM_CUSTOM 1
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
     #define LV_MEM_SIZE (48U * 1024U)          /*[bytes]*/
@@ -60,10 +70,19 @@
     #endif
 
 #else       /*LV_MEM_CUSTOM*/
-    #define LV_MEM_CUSTOM_INCLUDE <stdlib.h>   /*Header for the dynamic memory function*/
-    #define LV_MEM_CUSTOM_ALLOC   malloc
-    #define LV_MEM_CUSTOM_FREE    free
-    #define LV_MEM_CUSTOM_REALLOC realloc
+    /*The port (LCD/src/lv_port_mem.c) counts every allocation per size class and reports the fragmentation.
+     *The animations, timers and event descriptors come from its slabs (LV_PORT_MEM_SLAB in lv_port_mem.h).
+     *1: it serves LVGL from a TLSF pool of LV_MEM_SIZE bytes in the `.lvgl_pool` section (NOLOAD);
+     *0: from the FreeRTOS heap (configTOTAL_HEAP_SIZE has to be increased accordingly)*/
+    #define LV_MEM_CUSTOM_TLSF    1
+    /*[bytes] 32 kB on the target. The objects are about twice as large with 64 bit pointers (host tests)*/
+    #define LV_MEM_SIZE (32U * 1024U / 4U * sizeof(void *))
+
+    #define LV_MEM_CUSTOM_INCLUDE "lv_port_mem.h"   /*Header for the dynamic memory function*/
+    #define LV_MEM_CUSTOM_ALLOC   lv_port_mem_alloc
+    #define LV_MEM_CUSTOM_FREE    lv_port_mem_free
+    #define LV_MEM_CUSTOM_REALLOC lv_port_mem_realloc
+    #define LV_MEM_CUSTOM_MONITOR lv_port_mem_monitor /*Fills `lv_mem_monitor()`*/
 #endif     /*LV_MEM_CUSTOM*/
 
 /*Number of the intermediate memory buffer used during rendering and other internal processing mechanisms.
@@ -80,9 +99,17 @@
 /*Default display refresh period. LVG will redraw changed areas with this period time*/
 #define LV_DISP_DEF_REFR_PERIOD 30      /*[ms]*/
 
+/*Don't draw the parts of plain objects without draw event callbacks (e.g. the screen roots) covered by
+ *opaque children (images, bars). Max. number of pieces per object and stripe, 0: draw the whole objects*/
+#define LV_REFR_OCCLUSION 8
+
 /*Input device read period in milliseconds*/
 #define LV_INDEV_DEF_READ_PERIOD 30     /*[ms]*/
 
+/*1: keep the timers in a min-heap by their next run: lv_timer_handler() runs the ready ones without
+ *scanning all timers and returns the time till the next one (the sleep of the GUI task)*/
+#define LV_TIMER_HEAP 1
+
 /*Use a custom tick source that tells the elapsed time in milliseconds.
  *It removes the need to manually update the tick with `lv_tick_inc()`)*/
 #define LV_TICK_CUSTOM 0
@@ -121,8 +148,28 @@
     * radius * 4 bytes are used per circle (the most often used radiuses are saved)
     * 0: to disable caching */
     #define LV_CIRCLE_CACHE_SIZE 4
+
+    /*1: keep the cached circles from one refresh to the next instead of freeing them after every refresh*/
+    #define LV_CIRCLE_CACHE_KEEP 1
+
+    /*Number of rounded corners kept as masks by their radius and border width (lv_draw_sw_rect.c), 0: no cache.
+     *Opaque rounded backgrounds and even rounded borders blend the 4 corners from it and fill the rest.
+     *Corners up to 16 px are cached, 4 * max(radius, border_width)^2 bytes each*/
+    #define LV_RECT_CORNER_CACHE_SIZE 4
+
+    /*1: draw the arcs (lv_arc, lv_meter) line by line only between the outer circle and the hole (lv_draw_sw_arc.c),
+     *the visible span of a line comes from the cached circles.
+     *Off: no screen draws arcs, the host tests turn it on*/
+    #ifndef LV_ARC_SPANS
+        #define LV_ARC_SPANS 0
+    #endif
 #endif /*LV_DRAW_COMPLEX*/
 
+/*Keep the drawn letters expanded to 8 bit masks in an LRU cache (lv_draw_sw_letter.c), 0: no cache.
+ *[bytes] of glyph data, a letter takes box_w * box_h + 16 bytes and ~60 bytes of overhead (key, LRU item).
+ *Call lv_draw_sw_glyph_cache_clear() before freeing a font (lv_font_free(), FreeType)*/
+#define LV_GLYPH_CACHE_SIZE (6U * 1024U)
+
 /**
  * "Simple layers" are used when a widget has `style_opa < 255` to buffer the widget into a layer
  * and blend it as an image with the given opacity.
@@ -139,12 +186,16 @@
 #define LV_LAYER_SIMPLE_BUF_SIZE          (24 * 1024)
 #define LV_LAYER_SIMPLE_FALLBACK_BUF_SIZE (3 * 1024)
 
+/*Count the lookups of the image, gradient, circle, shadow, corner, glyph, label layout and style caches (LCD/src/lv_port_cache.c)*/
+#define LV_CACHE_STATS_INCLUDE "lv_port_cache.h"
+#define LV_CACHE_STATS(cache, hit) lv_port_cache_count(LV_PORT_CACHE_##cache, hit)
+
 /*Default image cache size. Image caching keeps the images opened.
  *If only the built-in image formats are used there is no real advantage of caching. (I.e. if no new image decoder is added)
  *With complex image decoders (e.g. PNG or JPG) caching can save the continuous open/decode of images.
  *However the opened images might consume additional RAM.
  *0: to disable caching*/
-#define LV_IMG_CACHE_DEF_SIZE 0
+#define LV_IMG_CACHE_DEF_SIZE 20     /*Every digit sprite of SolderingScreen.c (2 colors x 10)*/
 
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
@@ -155,7 +206,7 @@
  *LV_GRAD_CACHE_DEF_SIZE sets the size of this cache in bytes.
  *If the cache is too small the map will be allocated only while it's required for the drawing.
  *0 mean no caching.*/
-#define LV_GRAD_CACHE_DEF_SIZE 0
+#define LV_GRAD_CACHE_DEF_SIZE (2U * 1024U)    /*Allocated when the first gradient is drawn*/
 
 /*Allow dithering the gradients (to achieve visual smooth color gradients on limited color depth display)
  *LV_DITHER_GRADIENT implies allocating one or two more lines of the object's rendering surface
@@ -230,7 +281,7 @@
  *-----------*/
 
 /*Enable the log module*/
-#define LV_USE_LOG 0
+#define LV_USE_LOG LV_PORT_BENCHMARK
 #if LV_USE_LOG
 
     /*How important log should be added:
@@ -240,11 +291,11 @@
     *LV_LOG_LEVEL_ERROR       Only critical issue, when the system may fail
     *LV_LOG_LEVEL_USER        Only logs added by the user
     *LV_LOG_LEVEL_NONE        Do not log anything*/
-    #define LV_LOG_LEVEL LV_LOG_LEVEL_WARN
+    #define LV_LOG_LEVEL LV_LOG_LEVEL_USER
 
     /*1: Print the log with 'printf';
     *0: User need to register a callback with `lv_log_register_print_cb()`*/
-    #define LV_LOG_PRINTF 0
+    #define LV_LOG_PRINTF 1
 
     /*Enable/disable LV_LOG_TRACE in modules that produces a huge number of logs*/
     #define LV_LOG_TRACE_MEM        1
@@ -279,14 +330,14 @@
  *-----------*/
 
 /*1: Show CPU usage and FPS count*/
-#define LV_USE_PERF_MONITOR 0
+#define LV_USE_PERF_MONITOR LV_PORT_BENCHMARK
 #if LV_USE_PERF_MONITOR
     #define LV_USE_PERF_MONITOR_POS LV_ALIGN_BOTTOM_RIGHT
 #endif
 
 /*1: Show the used memory and the memory fragmentation
- * Requires LV_MEM_CUSTOM = 0*/
-#define LV_USE_MEM_MONITOR 0
+ * Requires LV_MEM_CUSTOM = 0 or LV_MEM_CUSTOM_MONITOR*/
+#define LV_USE_MEM_MONITOR LV_PORT_BENCHMARK
 #if LV_USE_MEM_MONITOR
     #define LV_USE_MEM_MONITOR_POS LV_ALIGN_BOTTOM_LEFT
 #endif
@@ -306,6 +357,10 @@
 
 #define LV_USE_USER_DATA 1
 
+/*1: the objects remember which properties their styles set (20 bytes per object), the lookups of
+ *the other properties don't search the styles*/
+#define LV_OBJ_STYLE_CACHE 1
+
 /*Garbage Collector settings
  *Used if lvgl is bound to higher level language and the memory is managed by that language*/
 #define LV_ENABLE_GC 0
@@ -367,7 +422,7 @@
 #define LV_FONT_MONTSERRAT_14 1
 #define LV_FONT_MONTSERRAT_16 0
 #define LV_FONT_MONTSERRAT_18 0
-#define LV_FONT_MONTSERRAT_20 0
+#define LV_FONT_MONTSERRAT_20 1
 #define LV_FONT_MONTSERRAT_22 0
 #define LV_FONT_MONTSERRAT_24 0
 #define LV_FONT_MONTSERRAT_26 0
@@ -406,8 +461,9 @@
  *Compiler error will be triggered if a font needs it.*/
 #define LV_FONT_FMT_TXT_LARGE 0
 
-/*Enables/disables support for compressed fonts.*/
-#define LV_USE_FONT_COMPRESSED 0
+/*Enables/disables support for compressed fonts.
+ *The text scenes of the benchmark use compressed fonts*/
+#define LV_USE_FONT_COMPRESSED LV_PORT_BENCHMARK
 
 /*Enable subpixel rendering*/
 #define LV_USE_FONT_SUBPX 0
@@ -491,6 +547,7 @@
 #if LV_USE_LABEL
     #define LV_LABEL_TEXT_SELECTION 1 /*Enable selecting text of the label*/
     #define LV_LABEL_LONG_TXT_HINT 1  /*Store some extra info in labels to speed up drawing of very long texts*/
+    #define LV_LABEL_LAYOUT_CACHE 2   /*Keep the size and the first lines of the text in the labels (0: disable)*/
 #endif
 
 #define LV_USE_LINE       1
@@ -744,7 +801,7 @@
 #define LV_USE_DEMO_KEYPAD_AND_ENCODER 0
 
 /*Benchmark your system*/
-#define LV_USE_DEMO_BENCHMARK 0
+#define LV_USE_DEMO_BENCHMARK LV_PORT_BENCHMARK
 #if LV_USE_DEMO_BENCHMARK
 /*Use RGB565A8 images with 16 bit color depth instead of ARGB8565*/
 #define LV_DEMO_BENCHMARK_RGB565A8 0
@@ -223,6 +223,14 @@ uint32_t lv_event_register_id(void);
  */
 void _lv_event_mark_deleted(struct _lv_obj_t * obj);
 
+/**
+ * Tell whether an event callback of an object gets the draw events (LV_EVENT_DRAW_MAIN_BEGIN ... LV_EVENT_DRAW_PART_END),
+ * e.g. because it's added with LV_EVENT_ALL
+ * @param obj pointer to an object
+ * @return true: at least one callback gets the draw events
+ */
+bool _lv_obj_has_draw_event_cb(const struct _lv_obj_t * obj);
+
 
 /**
  * Add an event handler function for an object.
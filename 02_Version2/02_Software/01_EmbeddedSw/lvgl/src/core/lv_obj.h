@@ -176,6 +176,9 @@ typedef struct _lv_obj_t {
     struct _lv_obj_t * parent;
     _lv_obj_spec_attr_t * spec_attr;
     _lv_obj_style_t * styles;
+#if LV_OBJ_STYLE_CACHE
+    _lv_obj_style_props_t style_props;
+#endif
 #if LV_USE_USER_DATA
     void * user_data;
 #endif
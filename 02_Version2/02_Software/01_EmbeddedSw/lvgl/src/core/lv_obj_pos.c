@@ -814,6 +814,14 @@ void lv_obj_transform_point(const lv_obj_t * obj, lv_point_t * p, bool recursive
 void lv_obj_get_transformed_area(const lv_obj_t * obj, lv_area_t * area, bool recursive,
                                  bool inv)
 {
+    /*Without transformation the area remains the same. Don't enlarge it for the rounding
+     *errors of the transformation or every invalidation would be 5 px bigger on each side.*/
+    const lv_obj_t * o = obj;
+    while(o && _lv_obj_get_layer_type(o) != LV_LAYER_TYPE_TRANSFORM) {
+        o = recursive ? lv_obj_get_parent(o) : NULL;
+    }
+    if(o == NULL) return;
+
     lv_point_t p[4] = {
         {area->x1, area->y1},
         {area->x1, area->y2},
@@ -45,6 +45,10 @@ typedef enum {
 static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector);
 static _lv_obj_style_t * get_trans_style(lv_obj_t * obj, uint32_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v);
+#if LV_OBJ_STYLE_CACHE
+    static bool has_style_prop(const lv_obj_t * obj, lv_style_prop_t prop);
+    static void collect_style_props(lv_obj_t * obj);
+#endif
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_del(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -99,6 +103,7 @@ void lv_obj_add_style(lv_obj_t * obj, lv_style_t * style, lv_style_selector_t se
     lv_memset_00(&obj->styles[i], sizeof(_lv_obj_style_t));
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
+    _lv_style_prop_gen_next();
 
     lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
 }
@@ -571,6 +576,11 @@ static _lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t se
 
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, lv_style_value_t * v)
 {
+#if LV_OBJ_STYLE_CACHE
+    /*Most of the properties are not set in any style of the object*/
+    if(!has_style_prop(obj, prop)) return LV_STYLE_RES_NOT_FOUND;
+#endif
+
     uint8_t group = 1 << _lv_style_get_prop_group(prop);
     int32_t weight = -1;
     lv_state_t state = obj->state;
@@ -636,6 +646,57 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_part_t part, lv_sty
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+#if LV_OBJ_STYLE_CACHE
+/**
+ * Check if a property might be set in a style of an object
+ * @param obj   pointer to an object
+ * @param prop  a style property
+ * @return      false: the property is surely not set in the styles of the object
+ */
+static bool has_style_prop(const lv_obj_t * obj, lv_style_prop_t prop)
+{
+    if(prop >= _LV_STYLE_NUM_BUILT_IN_PROPS) return true;
+
+    /*Collect the properties again if a style might have got a new one*/
+    bool hit = obj->style_props.gen == _lv_style_prop_gen;
+    LV_CACHE_STATS(STYLE, hit);
+    if(!hit) collect_style_props((lv_obj_t *)obj);
+
+    return (obj->style_props.props[prop >> 5] & (1UL << (prop & 0x1F))) != 0;
+}
+
+/**
+ * Collect the built-in properties of all the styles of an object into `obj->style_props`
+ * @param obj   pointer to an object
+ */
+static void collect_style_props(lv_obj_t * obj)
+{
+    _lv_obj_style_props_t * sp = &obj->style_props;
+    lv_memset_00(sp->props, sizeof(sp->props));
+
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        const lv_style_t * style = obj->styles[i].style;
+        uint32_t j;
+        for(j = 0; j < style->prop_cnt; j++) {
+            lv_style_prop_t prop;
+            if(style->prop1 == LV_STYLE_PROP_ANY) prop = style->v_p.const_props[j].prop;
+            else if(style->prop_cnt == 1) prop = style->prop1;
+            else {
+                const uint16_t * props = (const uint16_t *)(style->v_p.values_and_props +
+                                                            style->prop_cnt * sizeof(lv_style_value_t));
+                prop = props[j];
+            }
+
+            prop = LV_STYLE_PROP_ID_MASK(prop);
+            if(prop < _LV_STYLE_NUM_BUILT_IN_PROPS) sp->props[prop >> 5] |= 1UL << (prop & 0x1F);
+        }
+    }
+
+    sp->gen = _lv_style_prop_gen;
+}
+#endif
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -43,6 +43,19 @@ typedef struct {
     uint32_t is_trans : 1;
 } _lv_obj_style_t;
 
+#if LV_OBJ_STYLE_CACHE
+#define _LV_OBJ_STYLE_PROPS_WORDS ((_LV_STYLE_NUM_BUILT_IN_PROPS + 31) / 32)
+
+/**
+ * The built-in properties set in any style of an object (any part and state).
+ * The properties which are not set here are not searched in the styles.
+ */
+typedef struct {
+    uint32_t gen;   /**< `_lv_style_prop_gen` when `props` was collected*/
+    uint32_t props[_LV_OBJ_STYLE_PROPS_WORDS];
+} _lv_obj_style_props_t;
+#endif
+
 typedef struct {
     uint16_t time;
     uint16_t delay;
@@ -16,6 +16,7 @@
 #include "../misc/lv_math.h"
 #include "../misc/lv_gc.h"
 #include "../draw/lv_draw.h"
+#include "../draw/sw/lv_draw_sw.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../extra/others/snapshot/lv_snapshot.h"
 
@@ -26,6 +27,10 @@
 /*********************
  *      DEFINES
  *********************/
+/*Areas after an area (sorted by their top) to try to join with it when `area_cost_cb` is set*/
+#ifndef LV_REFR_JOIN_WINDOW
+    #define LV_REFR_JOIN_WINDOW 8
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -52,12 +57,18 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static void join_area_by_cost(void);
 static void refr_invalid_areas(void);
 static void refr_area(const lv_area_t * area_p);
 static void refr_area_part(lv_draw_ctx_t * draw_ctx);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_draw_ctx_t * draw_ctx, lv_obj_t * top_obj);
 static void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+static void draw_main(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+#if LV_REFR_OCCLUSION
+    static void draw_main_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj);
+    static uint32_t subtract_area(lv_area_t * pieces, uint32_t cnt, const lv_area_t * covered);
+#endif
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h);
 static void draw_buf_flush(lv_disp_t * disp);
 static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_p);
@@ -73,6 +84,7 @@ static void call_flush_cb(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_
  *  STATIC VARIABLES
  **********************/
 static uint32_t px_num;
+static lv_refr_overdraw_t overdraw;
 static lv_disp_t * disp_refr; /*Display being refreshed*/
 
 #if LV_USE_PERF_MONITOR
@@ -143,9 +155,17 @@ void lv_obj_redraw(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
     if(should_draw) {
         draw_ctx->clip_area = &clip_coords_for_obj;
 
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
-        lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+#if LV_REFR_OCCLUSION
+        /*Drawn in pieces the event callbacks would get the draw events more times*/
+        if(com_clip_res && obj->class_p == &lv_obj_class && !_lv_obj_has_draw_event_cb(obj)) {
+            draw_main_occluded(draw_ctx, obj);
+        }
+        else {
+            draw_main(draw_ctx, obj);
+        }
+#else
+        draw_main(draw_ctx, obj);
+#endif
 #if LV_USE_REFR_DEBUG
         lv_color_t debug_color = lv_color_make(lv_rand(0, 0xFF), lv_rand(0, 0xFF), lv_rand(0, 0xFF));
         lv_draw_rect_dsc_t draw_dsc;
@@ -342,8 +362,10 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     lv_mem_buf_free_all();
     _lv_font_clean_up_fmt_txt();
 
-#if LV_DRAW_COMPLEX
+#if LV_DRAW_COMPLEX && !(defined(LV_CIRCLE_CACHE_KEEP) && LV_CIRCLE_CACHE_KEEP)
     _lv_draw_mask_cleanup();
+    /*The corners are calculated from the circles: kept as long as them*/
+    lv_draw_sw_rect_corner_cache_clear();
 #endif
 
 #if LV_USE_PERF_MONITOR && LV_USE_LABEL
@@ -403,7 +425,7 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     }
 #endif
 
-#if LV_USE_MEM_MONITOR && LV_MEM_CUSTOM == 0 && LV_USE_LABEL
+#if LV_USE_MEM_MONITOR && (LV_MEM_CUSTOM == 0 || defined(LV_MEM_CUSTOM_MONITOR)) && LV_USE_LABEL
     lv_obj_t * mem_label = mem_monitor.mem_label;
     if(mem_label == NULL) {
         mem_label = lv_label_create(lv_layer_sys());
@@ -437,6 +459,11 @@ void _lv_disp_refr_timer(lv_timer_t * tmr)
     REFR_TRACE("finished");
 }
 
+const lv_refr_overdraw_t * lv_refr_get_overdraw(void)
+{
+    return &overdraw;
+}
+
 #if LV_USE_PERF_MONITOR
 void lv_refr_reset_fps_counter(void)
 {
@@ -466,6 +493,12 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
+
+    if(disp_refr->driver->area_cost_cb) {
+        join_area_by_cost();
+        return;
+    }
+
     for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
         if(disp_refr->inv_area_joined[join_in] != 0) continue;
 
@@ -495,6 +528,65 @@ static void lv_refr_join_area(void)
     }
 }
 
+/**
+ * Join the areas if the driver estimates that refreshing them together is cheaper (`area_cost_cb`).
+ * The unjoined areas are sorted by their top and an area is compared only with the next
+ * LV_REFR_JOIN_WINDOW areas. Repeated until nothing is joined: an area grown by a join
+ * can reach an other one.
+ */
+static void join_area_by_cost(void)
+{
+    lv_disp_drv_t * drv = disp_refr->driver;
+    lv_area_t * areas = disp_refr->inv_areas;
+    uint8_t * joined = disp_refr->inv_area_joined;
+    uint16_t order[LV_INV_BUF_SIZE];
+    uint32_t cost[LV_INV_BUF_SIZE];
+    uint32_t cnt = 0;
+    uint32_t i;
+    uint32_t j;
+    bool changed;
+
+    /*Insertion sort: at most LV_INV_BUF_SIZE areas, mostly invalidated from top to bottom*/
+    for(i = 0; i < disp_refr->inv_p; i++) {
+        if(joined[i]) continue;
+        cost[i] = drv->area_cost_cb(drv, &areas[i]);
+        for(j = cnt; j > 0 && areas[order[j - 1]].y1 > areas[i].y1; j--) order[j] = order[j - 1];
+        order[j] = (uint16_t)i;
+        cnt++;
+    }
+
+    do {
+        changed = false;
+        for(i = 0; i < cnt; i++) {
+            uint32_t join_in = order[i];
+            if(joined[join_in]) continue;
+
+            uint32_t k;
+            for(k = i + 1; k < cnt && k <= i + LV_REFR_JOIN_WINDOW; k++) {
+                uint32_t join_from = order[k];
+                if(joined[join_from]) continue;
+
+                /*The top of the joined area is the top of 'join_in': the order remains*/
+                lv_area_t joined_area;
+                _lv_area_join(&joined_area, &areas[join_in], &areas[join_from]);
+                uint32_t joined_cost = drv->area_cost_cb(drv, &joined_area);
+                if(joined_cost < cost[join_in] + cost[join_from]) {
+                    lv_area_copy(&areas[join_in], &joined_area);
+                    cost[join_in] = joined_cost;
+                    joined[join_from] = 1;
+                    changed = true;
+                }
+            }
+        }
+
+        /*Remove the joined areas from the order*/
+        for(i = 0, j = 0; i < cnt; i++) {
+            if(joined[order[i]] == 0) order[j++] = order[i];
+        }
+        cnt = j;
+    } while(changed);
+}
+
 /**
  * Refresh the joined areas
  */
@@ -504,6 +596,8 @@ static void refr_invalid_areas(void)
 
     if(disp_refr->inv_p == 0) return;
 
+    lv_memset_00(&overdraw, sizeof(overdraw));
+
     /*Find the last area which will be drawn*/
     int32_t i;
     int32_t last_i = 0;
@@ -529,6 +623,8 @@ static void refr_invalid_areas(void)
 
             if(i == last_i) disp_refr->driver->draw_buf->last_area = 1;
             disp_refr->driver->draw_buf->last_part = 0;
+            /*Before refreshing: complete at the last flush*/
+            overdraw.px += lv_area_get_size(&disp_refr->inv_areas[i]);
             refr_area(&disp_refr->inv_areas[i]);
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
@@ -965,6 +1061,113 @@ void refr_obj(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
 }
 
 
+/**
+ * Send the main drawing events to an object on the clip area of the draw context
+ */
+static void draw_main(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    overdraw.drawn_px += lv_area_get_size(draw_ctx->clip_area);
+
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_BEGIN, draw_ctx);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN, draw_ctx);
+    lv_event_send(obj, LV_EVENT_DRAW_MAIN_END, draw_ctx);
+}
+
+#if LV_REFR_OCCLUSION
+/**
+ * Draw a plain object only where its children don't cover it.
+ * The clip area is cut into at most LV_REFR_OCCLUSION pieces around the children which
+ * pass the cover check (as in `lv_refr_get_top_obj()`) and the object is drawn on each piece.
+ * A plain object draws only a rectangle: the pixels of a piece don't depend on the clip area.
+ * The draw events are sent once per piece, each with an other clip area, so it's used only
+ * for objects without callbacks of the draw events.
+ */
+static void draw_main_occluded(lv_draw_ctx_t * draw_ctx, lv_obj_t * obj)
+{
+    const lv_area_t * clip_area = draw_ctx->clip_area;
+    lv_area_t pieces[LV_REFR_OCCLUSION];
+    lv_area_t clip_children;
+    uint32_t cnt = 1;
+    uint32_t i;
+
+    pieces[0] = *clip_area;
+
+    /*The children are masked by the clip corner and by the masks of the parents:
+     *they wouldn't cover the anti-aliased edges*/
+    bool occlude = !lv_obj_get_style_clip_corner(obj, LV_PART_MAIN) && !lv_draw_mask_is_any(clip_area);
+
+    /*Where the children are drawn (see `lv_obj_redraw()`)*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) clip_children = *clip_area;
+    else if(!_lv_area_intersect(&clip_children, clip_area, &obj->coords)) occlude = false;
+
+    uint32_t child_cnt = occlude ? lv_obj_get_child_cnt(obj) : 0;
+    for(i = 0; i < child_cnt && cnt > 0; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        lv_area_t covered;
+        if(!_lv_area_intersect(&covered, &clip_children, &child->coords)) continue;
+        if(lv_refr_get_top_obj(&covered, child) == NULL) continue;
+
+        cnt = subtract_area(pieces, cnt, &covered);
+    }
+
+    overdraw.skipped_px += lv_area_get_size(clip_area);
+    for(i = 0; i < cnt; i++) {
+        draw_ctx->clip_area = &pieces[i];
+        overdraw.skipped_px -= lv_area_get_size(&pieces[i]);
+        draw_main(draw_ctx, obj);
+    }
+    draw_ctx->clip_area = clip_area;
+}
+
+/**
+ * Remove an area from the pieces. A piece is replaced by its parts above, below, left and right
+ * of the area, a piece is kept if its parts don't fit into LV_REFR_OCCLUSION pieces.
+ * @param pieces    the pieces, not overlapping
+ * @param cnt       number of pieces
+ * @param covered   the area to remove
+ * @return          the new number of pieces
+ */
+static uint32_t subtract_area(lv_area_t * pieces, uint32_t cnt, const lv_area_t * covered)
+{
+    uint32_t i = 0;
+
+    while(i < cnt) {
+        lv_area_t * p = &pieces[i];
+        lv_area_t com;
+        lv_area_t parts[4];
+        uint32_t part_cnt = 0;
+
+        if(!_lv_area_intersect(&com, p, covered)) {
+            i++;
+            continue;
+        }
+
+        if(p->y1 < com.y1) lv_area_set(&parts[part_cnt++], p->x1, p->y1, p->x2, com.y1 - 1);
+        if(p->y2 > com.y2) lv_area_set(&parts[part_cnt++], p->x1, com.y2 + 1, p->x2, p->y2);
+        if(p->x1 < com.x1) lv_area_set(&parts[part_cnt++], p->x1, com.y1, com.x1 - 1, com.y2);
+        if(p->x2 > com.x2) lv_area_set(&parts[part_cnt++], com.x2 + 1, com.y1, p->x2, com.y2);
+
+        if(part_cnt == 0) {
+            /*Fully covered: replace it with the last piece*/
+            *p = pieces[--cnt];
+            continue;
+        }
+
+        if(cnt + part_cnt - 1 > LV_REFR_OCCLUSION) {
+            i++;
+            continue;
+        }
+
+        uint32_t k;
+        *p = parts[0];
+        for(k = 1; k < part_cnt; k++) pieces[cnt++] = parts[k];
+        i++;
+    }
+
+    return cnt;
+}
+#endif /*LV_REFR_OCCLUSION*/
+
 static uint32_t get_max_row(lv_disp_t * disp, lv_coord_t area_w, lv_coord_t area_h)
 {
     int32_t max_row = (uint32_t)disp->driver->draw_buf->size / area_w;
@@ -22,10 +22,25 @@ extern "C" {
 
 #define LV_REFR_TASK_PRIO LV_TASK_PRIO_MID
 
+/*Skip the parts of the background of plain objects (`lv_obj_class`) which are covered by
+ *opaque children. Max. number of pieces the drawing of an object is split into (0: disable).*/
+#ifndef LV_REFR_OCCLUSION
+#define LV_REFR_OCCLUSION 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Pixels drawn in a refresh. `drawn_px / px` is the overdraw: how many objects draw a pixel on average.
+ */
+typedef struct {
+    uint32_t px;            /**< pixels of the refreshed areas*/
+    uint32_t drawn_px;      /**< pixels of the objects on the refreshed areas (their main drawing)*/
+    uint32_t skipped_px;    /**< pixels of backgrounds not drawn because opaque children cover them*/
+} lv_refr_overdraw_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -98,6 +113,12 @@ void lv_refr_reset_fps_counter(void);
 uint32_t lv_refr_get_fps_avg(void);
 #endif
 
+/**
+ * Get the pixels drawn in the last refresh. Updated while rendering: complete after the last flush.
+ * @return pointer to the counters
+ */
+const lv_refr_overdraw_t * lv_refr_get_overdraw(void);
+
 /**
  * Called periodically to handle the refreshing
  * @param timer pointer to the timer itself
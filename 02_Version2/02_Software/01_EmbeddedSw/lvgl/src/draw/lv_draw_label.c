@@ -34,6 +34,11 @@ typedef uint8_t cmd_state_t;
  *  STATIC PROTOTYPES
  **********************/
 
+static bool layout_usable(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, lv_coord_t max_width);
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                             const char * txt, uint32_t line_start, lv_coord_t max_width);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                              const char * txt, uint32_t line_start, uint32_t line_end);
 static uint8_t hex_char_to_num(char hex);
 
 /**********************
@@ -106,16 +111,26 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     lv_bidi_calculate_align(&align, &base_dir, txt);
 
+    /*Use the lines of the layout only if it was made with the same parameters*/
+    const lv_txt_layout_t * layout = dsc->layout;
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
+        if(layout && !layout_usable(dsc, layout, w)) layout = NULL;
     }
     else {
         /*If EXPAND is enabled then not limit the text's width to the object's width*/
-        lv_point_t p;
-        lv_txt_get_size(&p, txt, dsc->font, dsc->letter_space, dsc->line_space, LV_COORD_MAX,
-                        dsc->flag);
-        w = p.x;
+        if(layout && !layout_usable(dsc, layout, LV_COORD_MAX)) layout = NULL;
+        if(layout) {
+            w = layout->size.x;
+        }
+        else {
+            lv_point_t p;
+            lv_txt_get_size(&p, txt, dsc->font, dsc->letter_space, dsc->line_space, LV_COORD_MAX,
+                            dsc->flag);
+            w = p.x;
+        }
     }
 
     int32_t line_height_font = lv_font_get_line_height(font);
@@ -149,15 +164,18 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
     if(hint && last_line_start >= 0) {
         line_start = last_line_start;
         pos.y += hint->y;
+        layout = NULL;  /*The index of the line is not known*/
     }
 
-    uint32_t line_end = line_start + _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+    uint32_t line_idx = 0;
+    uint32_t line_end = get_line_end(dsc, layout, line_idx, txt, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_ctx->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_idx, txt, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -172,14 +190,14 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, layout, line_idx, txt, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+        line_width = get_line_width(dsc, layout, line_idx, txt, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
     uint32_t sel_start = dsc->sel_start;
@@ -334,21 +352,20 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_label(lv_draw_ctx_t * draw_ctx, const lv_draw
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += _lv_txt_get_next_line(&txt[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_idx++;
+        line_end = get_line_end(dsc, layout, line_idx, txt, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, layout, line_idx, txt, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_txt_get_width(&txt[line_start], line_end - line_start, font, dsc->letter_space, dsc->flag);
+            line_width = get_line_width(dsc, layout, line_idx, txt, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -372,6 +389,45 @@ void lv_draw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Check if the lines of a layout are the lines `lv_draw_label()` would find
+ * @param dsc       the draw descriptor
+ * @param layout    the layout of the text
+ * @param max_width the width to break the lines
+ * @return          true: the layout can be used
+ */
+static bool layout_usable(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, lv_coord_t max_width)
+{
+    if(dsc->flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    return layout->valid && layout->font == dsc->font && layout->letter_space == dsc->letter_space &&
+           layout->max_width == max_width && layout->flag == (dsc->flag & LV_TEXT_FLAG_RECOLOR);
+}
+
+/**
+ * Find the end of a line, from the layout if it has stored the line
+ * @return the index of the first character of the next line
+ */
+static uint32_t get_line_end(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                             const char * txt, uint32_t line_start, lv_coord_t max_width)
+{
+    if(layout && line_idx < layout->line_cnt && line_idx < _LV_TXT_LAYOUT_LINES) return layout->line_end[line_idx];
+
+    return line_start + _lv_txt_get_next_line(&txt[line_start], dsc->font, dsc->letter_space, max_width, NULL,
+                                              dsc->flag);
+}
+
+/**
+ * Get the width of a line, from the layout if it has stored the line
+ */
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_txt_layout_t * layout, uint32_t line_idx,
+                              const char * txt, uint32_t line_start, uint32_t line_end)
+{
+    if(layout && line_idx < layout->line_cnt && line_idx < _LV_TXT_LAYOUT_LINES) return layout->line_w[line_idx];
+
+    return lv_txt_get_width(&txt[line_start], line_end - line_start, dsc->font, dsc->letter_space, dsc->flag);
+}
+
 /**
  * Convert a hexadecimal characters to a number (0..15)
  * @param hex Pointer to a hexadecimal character (0..9, A..F)
@@ -44,6 +44,7 @@ typedef struct {
     lv_text_flag_t flag;
     lv_text_decor_t decor : 3;
     lv_blend_mode_t blend_mode: 3;
+    const lv_txt_layout_t * layout;     /**< The lines of the text from `_lv_txt_layout()` or NULL*/
 } lv_draw_label_dsc_t;
 
 /** Store some info to speed up drawing of very large texts
@@ -499,11 +499,13 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
             LV_GC_ROOT(_lv_circle_cache[i]).used_cnt++;
             CIRCLE_CACHE_AGING(LV_GC_ROOT(_lv_circle_cache[i]).life, radius);
             param->circle = &LV_GC_ROOT(_lv_circle_cache[i]);
+            LV_CACHE_STATS(CIRCLE, true);
             return;
         }
     }
 
     /*If not found find a free entry with lowest life*/
+    LV_CACHE_STATS(CIRCLE, false);
     _lv_draw_mask_radius_circle_dsc_t * entry = NULL;
     for(i = 0; i < LV_CIRCLE_CACHE_SIZE; i++) {
         if(LV_GC_ROOT(_lv_circle_cache[i]).used_cnt == 0) {
@@ -529,6 +531,43 @@ void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area
     circ_calc_aa4(param->circle, radius);
 }
 
+void lv_draw_mask_radius_get_span(const lv_draw_mask_radius_param_t * param, lv_coord_t abs_y, lv_coord_t * x1,
+                                  lv_coord_t * x2)
+{
+    const lv_area_t * rect = &param->cfg.rect;
+    lv_coord_t radius = param->cfg.radius;
+
+    if(abs_y < rect->y1 || abs_y > rect->y2) {
+        *x1 = rect->x1;
+        *x2 = rect->x1 - 1;
+        return;
+    }
+
+    /*The straight part: a normal mask keeps the rectangle, an inverted one clears it*/
+    if(radius == 0 || (abs_y >= rect->y1 + radius && abs_y <= rect->y2 - radius)) {
+        *x1 = rect->x1;
+        *x2 = rect->x2;
+        return;
+    }
+
+    /*The same pixels as lv_draw_mask_radius() anti-aliases or clears*/
+    lv_coord_t w = lv_area_get_width(rect);
+    lv_coord_t h = lv_area_get_height(rect);
+    lv_coord_t cir_y = abs_y - rect->y1 < radius ? radius - (abs_y - rect->y1) - 1 : abs_y - rect->y1 - (h - radius);
+    lv_coord_t aa_len;
+    lv_coord_t x_start;
+    get_next_line(param->circle, cir_y, &aa_len, &x_start);
+
+    if(param->cfg.outer == 0) {
+        *x1 = rect->x1 + radius - x_start - aa_len;
+        *x2 = rect->x1 + w - radius + x_start + aa_len - 1;
+    }
+    else {
+        *x1 = rect->x1 + radius - x_start;
+        *x2 = rect->x1 + w - radius + x_start - 1;
+    }
+}
+
 /**
  * Initialize a fade mask.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
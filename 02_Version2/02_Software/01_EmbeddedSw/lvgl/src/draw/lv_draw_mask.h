@@ -359,6 +359,18 @@ void lv_draw_mask_angle_init(lv_draw_mask_angle_param_t * param, lv_coord_t vert
  */
 void lv_draw_mask_radius_init(lv_draw_mask_radius_param_t * param, const lv_area_t * rect, lv_coord_t radius, bool inv);
 
+/**
+ * Get the part of a line a radius mask can leave visible, from its cached circle.
+ * Drawing can skip the rest of the line.
+ * @param param pointer to an initialized radius mask
+ * @param abs_y Y coordinate of the line (absolute coordinates)
+ * @param x1    normal mask: the first pixel which can be visible; inverted mask: the first transparent pixel
+ * @param x2    normal mask: the last pixel which can be visible; inverted mask: the last transparent pixel.
+ *              `x1 > x2` if there is no such pixel
+ */
+void lv_draw_mask_radius_get_span(const lv_draw_mask_radius_param_t * param, lv_coord_t abs_y, lv_coord_t * x1,
+                                  lv_coord_t * x2);
+
 /**
  * Initialize a fade mask.
  * @param param pointer to a `lv_draw_mask_param_t` to initialize
@@ -55,12 +55,36 @@ void lv_draw_sw_wait_for_finish(lv_draw_ctx_t * draw_ctx);
 void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, const lv_point_t * center, uint16_t radius,
                     uint16_t start_angle, uint16_t end_angle);
 
+/**
+ * Draw the arcs only between the outer circle and the hole of each line (LV_ARC_SPANS) or over the whole
+ * quarters as without it, e.g. to measure what it saves. Spans are used by default, no effect if LV_ARC_SPANS is 0.
+ * @param en    true: draw the spans, false: the whole quarters
+ */
+void lv_draw_sw_arc_spans_enable(bool en);
+
 void lv_draw_sw_rect(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 
 void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * coords);
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
                        uint32_t letter);
 
+/**
+ * Drop the letters from the glyph cache (LV_GLYPH_CACHE_SIZE), e.g. before freeing a font
+ */
+void lv_draw_sw_glyph_cache_clear(void);
+
+/**
+ * Free the corners of the rounded rectangles kept in the corner cache (LV_RECT_CORNER_CACHE_SIZE)
+ */
+void lv_draw_sw_rect_corner_cache_clear(void);
+
+/**
+ * Use or bypass the corner cache (LV_RECT_CORNER_CACHE_SIZE). Bypassed, the rectangles are drawn
+ * as without the cache, e.g. to measure what it saves. Used by default.
+ * @param en    true: use the cache, false: bypass it
+ */
+void lv_draw_sw_rect_corner_cache_enable(bool en);
+
 void /* LV_ATTRIBUTE_FAST_MEM */ lv_draw_sw_img_decoded(struct _lv_draw_ctx_t * draw_ctx,
                                                         const lv_draw_img_dsc_t * draw_dsc,
                                                         const lv_area_t * coords, const uint8_t * src_buf,
@@ -18,6 +18,11 @@
 #define SPLIT_RADIUS_LIMIT 10  /*With radius greater than this the arc will drawn in quarters. A quarter is drawn only if there is arc in it*/
 #define SPLIT_ANGLE_GAP_LIMIT 60  /*With small gaps in the arc don't bother with splitting because there is nothing to skip.*/
 
+/*1: draw an arc line by line only where its ring can be visible, skip the hole and the outside of the circle*/
+#ifndef LV_ARC_SPANS
+    #define LV_ARC_SPANS 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +37,8 @@ typedef struct {
     lv_draw_rect_dsc_t * draw_dsc;
     const lv_area_t * draw_area;
     lv_draw_ctx_t * draw_ctx;
+    const lv_draw_mask_radius_param_t * mask_out;   /*NULL: draw with lv_draw_rect()*/
+    const lv_draw_mask_radius_param_t * mask_in;
 } quarter_draw_dsc_t;
 
 /**********************
@@ -43,11 +50,16 @@ typedef struct {
     static void draw_quarter_2(quarter_draw_dsc_t * q);
     static void draw_quarter_3(quarter_draw_dsc_t * q);
     static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness, lv_area_t * res_area);
+    static void draw_ring(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * area,
+                          const lv_draw_mask_radius_param_t * mask_out, const lv_draw_mask_radius_param_t * mask_in);
 #endif /*LV_DRAW_COMPLEX*/
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_DRAW_COMPLEX && LV_ARC_SPANS
+    static bool spans_disabled;
+#endif
 
 /**********************
  *      MACROS
@@ -87,6 +99,13 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
     area_out.x2 = center->x + radius - 1;  /*-1 because the center already belongs to the left/bottom part*/
     area_out.y2 = center->y + radius - 1;
 
+    /*Only the masks of the ring: they tell where it can be visible on a line*/
+#if LV_ARC_SPANS
+    bool spans = !spans_disabled && dsc->img_src == NULL && !lv_draw_mask_is_any(&area_out);
+#else
+    bool spans = false;
+#endif
+
     lv_area_t area_in;
     lv_area_copy(&area_in, &area_out);
     area_in.x1 += dsc->width;
@@ -154,6 +173,8 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
         q_dsc.draw_dsc = &cir_dsc;
         q_dsc.draw_area = &area_out;
         q_dsc.draw_ctx = draw_ctx;
+        q_dsc.mask_out = spans ? &mask_out_param : NULL;
+        q_dsc.mask_in = spans && mask_in_param_valid ? &mask_in_param : NULL;
 
         draw_quarter_0(&q_dsc);
         draw_quarter_1(&q_dsc);
@@ -161,7 +182,8 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
         draw_quarter_3(&q_dsc);
     }
     else {
-        lv_draw_rect(draw_ctx, &cir_dsc, &area_out);
+        draw_ring(draw_ctx, &cir_dsc, &area_out, spans ? &mask_out_param : NULL,
+                  spans && mask_in_param_valid ? &mask_in_param : NULL);
     }
 
     lv_draw_mask_free_param(&mask_angle_param);
@@ -222,6 +244,15 @@ void lv_draw_sw_arc(lv_draw_ctx_t * draw_ctx, const lv_draw_arc_dsc_t * dsc, con
 #endif /*LV_DRAW_COMPLEX*/
 }
 
+void lv_draw_sw_arc_spans_enable(bool en)
+{
+#if LV_DRAW_COMPLEX && LV_ARC_SPANS
+    spans_disabled = !en;
+#else
+    LV_UNUSED(en);
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -243,7 +274,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     else if(q->start_quarter == 0 || q->end_quarter == 0) {
@@ -258,7 +289,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
         if(q->end_quarter == 0) {
@@ -271,7 +302,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
     }
@@ -288,7 +319,7 @@ static void draw_quarter_0(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -310,7 +341,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     else if(q->start_quarter == 1 || q->end_quarter == 1) {
@@ -325,7 +356,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
         if(q->end_quarter == 1) {
@@ -338,7 +369,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
     }
@@ -355,7 +386,7 @@ static void draw_quarter_1(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -377,7 +408,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     else if(q->start_quarter == 2 || q->end_quarter == 2) {
@@ -392,7 +423,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
         if(q->end_quarter == 2) {
@@ -405,7 +436,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
     }
@@ -422,7 +453,7 @@ static void draw_quarter_2(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     q->draw_ctx->clip_area = clip_area_ori;
@@ -444,7 +475,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
     else if(q->start_quarter == 3 || q->end_quarter == 3) {
@@ -459,7 +490,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
         if(q->end_quarter == 3) {
@@ -472,7 +503,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
             bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
             if(ok) {
                 q->draw_ctx->clip_area = &quarter_area;
-                lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+                draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
             }
         }
     }
@@ -489,7 +520,7 @@ static void draw_quarter_3(quarter_draw_dsc_t * q)
         bool ok = _lv_area_intersect(&quarter_area, &quarter_area, clip_area_ori);
         if(ok) {
             q->draw_ctx->clip_area = &quarter_area;
-            lv_draw_rect(q->draw_ctx, q->draw_dsc, q->draw_area);
+            draw_ring(q->draw_ctx, q->draw_dsc, q->draw_area, q->mask_out, q->mask_in);
         }
     }
 
@@ -534,4 +565,80 @@ static void get_rounded_area(int16_t angle, lv_coord_t radius, uint8_t thickness
     }
 }
 
+/**
+ * Draw the part of an arc in the clip area.
+ * With the masks of the ring only the pixels between the outer circle and the hole are masked and blended
+ * on each line, with the same result as lv_draw_rect() on the whole area.
+ * @param draw_ctx  pointer to a draw context
+ * @param dsc       the color and opacity of the arc in `bg_color` and `bg_opa`
+ * @param area      the area of the outer circle
+ * @param mask_out  the mask of the outer circle, NULL: draw the area with lv_draw_rect()
+ * @param mask_in   the mask of the hole or NULL if there is no hole
+ */
+static void draw_ring(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, const lv_area_t * area,
+                      const lv_draw_mask_radius_param_t * mask_out, const lv_draw_mask_radius_param_t * mask_in)
+{
+    if(mask_out == NULL) {
+        lv_draw_rect(draw_ctx, dsc, area);
+        return;
+    }
+
+    if(dsc->bg_opa <= LV_OPA_MIN) return;
+
+    lv_area_t clipped;
+    if(!_lv_area_intersect(&clipped, area, draw_ctx->clip_area)) return;
+
+    /*As the line by line drawing of draw_bg(): the mask is initialized to the opacity*/
+    lv_opa_t opa = dsc->bg_opa >= LV_OPA_MAX ? LV_OPA_COVER : dsc->bg_opa;
+    lv_opa_t * mask_buf = lv_mem_buf_get(lv_area_get_width(&clipped));
+
+    lv_area_t blend_area;
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &blend_area;
+    blend_dsc.mask_area = &blend_area;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.color = dsc->bg_color;
+    blend_dsc.opa = LV_OPA_COVER;
+    blend_dsc.blend_mode = dsc->blend_mode;
+
+    lv_coord_t y;
+    for(y = clipped.y1; y <= clipped.y2; y++) {
+        lv_coord_t x1;
+        lv_coord_t x2;
+        lv_draw_mask_radius_get_span(mask_out, y, &x1, &x2);
+        x1 = LV_MAX(x1, clipped.x1);
+        x2 = LV_MIN(x2, clipped.x2);
+
+        lv_coord_t hole_x1 = x2 + 1;
+        lv_coord_t hole_x2 = x2;
+        if(mask_in) {
+            lv_draw_mask_radius_get_span(mask_in, y, &hole_x1, &hole_x2);
+            if(hole_x1 > hole_x2) {
+                hole_x1 = x2 + 1;
+                hole_x2 = x2;
+            }
+        }
+
+        /*Left of the hole, right of the hole*/
+        uint32_t i;
+        for(i = 0; i < 2; i++) {
+            blend_area.x1 = i == 0 ? x1 : LV_MAX(x1, hole_x2 + 1);
+            blend_area.x2 = i == 0 ? LV_MIN(x2, hole_x1 - 1) : x2;
+            if(blend_area.x1 > blend_area.x2) continue;
+            blend_area.y1 = y;
+            blend_area.y2 = y;
+
+            lv_coord_t len = lv_area_get_width(&blend_area);
+            lv_memset(mask_buf, opa, len);
+            blend_dsc.mask_res = lv_draw_mask_apply(mask_buf, blend_area.x1, y, len);
+            if(blend_dsc.mask_res == LV_DRAW_MASK_RES_TRANSP) continue;
+            blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+            lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        }
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+
 #endif /*LV_DRAW_COMPLEX*/
@@ -57,16 +57,24 @@ static uint8_t * grad_cache_end = 0;
 /**********************
  *   STATIC FUNCTIONS
  **********************/
-union void_cast {
-    const void * ptr;
-    const uint32_t value;
-};
-
+/*Hash the content of the descriptor, not its address: the descriptors are
+ *built on the stack of the draw functions, so the address is not stable*/
 static uint32_t compute_key(const lv_grad_dsc_t * g, lv_coord_t size, lv_coord_t w)
 {
-    union void_cast v;
-    v.ptr = g;
-    return (v.value ^ size ^ (w >> 1)); /*Yes, this is correct, it's like a hash that changes if the width changes*/
+    uint32_t key = 2166136261U;     /*FNV-1a*/
+    uint8_t i;
+
+#define KEY_ADD(v)  key = (key ^ (uint32_t)(v)) * 16777619U
+    for(i = 0; i < g->stops_count; i++) {
+        KEY_ADD(lv_color_to32(g->stops[i].color));
+        KEY_ADD(g->stops[i].frac);
+    }
+    KEY_ADD(g->dir | (g->dither << 3));
+    KEY_ADD(size);
+    KEY_ADD(w);
+#undef KEY_ADD
+
+    return key;
 }
 
 static size_t get_cache_item_size(lv_grad_t * c)
@@ -266,10 +274,12 @@ lv_grad_t * lv_gradient_get(const lv_grad_dsc_t * g, lv_coord_t w, lv_coord_t h)
     lv_grad_t * item = NULL;
     if(iterate_cache(&find_item, &key, &item) == LV_RES_OK) {
         item->life++; /* Don't forget to bump the counter */
+        LV_CACHE_STATS(GRAD, true);
         return item;
     }
 
     /* Step 2: Need to allocate an item for it */
+    LV_CACHE_STATS(GRAD, false);
     item = allocate_item(g, w, h);
     if(item == NULL) {
         LV_LOG_WARN("Faild to allcoate item for teh gradient");
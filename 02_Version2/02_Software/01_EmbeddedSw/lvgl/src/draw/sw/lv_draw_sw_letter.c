@@ -14,14 +14,33 @@
 #include "../../misc/lv_style.h"
 #include "../../font/lv_font.h"
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_lru.h"
 
 /*********************
  *      DEFINES
  *********************/
+/*[bytes] the size of the cache of the expanded letters, 0: no cache*/
+#ifndef LV_GLYPH_CACHE_SIZE
+    #define LV_GLYPH_CACHE_SIZE 0
+#endif
+
+/*The expected size of a cached letter, sets the size of the hash table of the cache*/
+#define GLYPH_CACHE_AVG_SIZE    128
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_GLYPH_CACHE_SIZE
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+} glyph_key_t;
+
+/*Followed by the mask of the letter: box_w * box_h opacities of a letter drawn with LV_OPA_COVER*/
+typedef struct {
+    lv_font_glyph_dsc_t g;
+} glyph_entry_t;
+#endif /*LV_GLYPH_CACHE_SIZE*/
 
 /**********************
  *  STATIC PROTOTYPES
@@ -36,9 +55,20 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
                               lv_font_glyph_dsc_t * g, const uint8_t * map_p);
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if LV_GLYPH_CACHE_SIZE
+static const glyph_entry_t * glyph_cache_get(const lv_font_t * font, uint32_t letter);
+static const glyph_entry_t * glyph_cache_add(const lv_font_t * font, uint32_t letter, const lv_font_glyph_dsc_t * g,
+                                             const uint8_t * map_p);
+static void draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc, const lv_point_t * pos_p,
+                               const glyph_entry_t * entry);
+#endif /*LV_GLYPH_CACHE_SIZE*/
+
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_GLYPH_CACHE_SIZE
+static lv_lru_t * glyph_cache;
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -95,6 +125,14 @@ const uint8_t _lv_bpp8_opa_table[256] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 1
 void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,  const lv_point_t * pos_p,
                        uint32_t letter)
 {
+#if LV_GLYPH_CACHE_SIZE
+    const glyph_entry_t * entry = glyph_cache_get(dsc->font, letter);
+    if(entry) {
+        draw_letter_cached(draw_ctx, dsc, pos_p, entry);
+        return;
+    }
+#endif
+
     lv_font_glyph_dsc_t g;
     bool g_ret = lv_font_get_glyph_dsc(dsc->font, &g, letter, '\0');
     if(g_ret == false) {
@@ -122,11 +160,23 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
             draw_ctx->draw_rect(draw_ctx, &glyph_dsc, &glyph_coords);
 #endif
         }
+#if LV_GLYPH_CACHE_SIZE
+        else {
+            /*Nothing to draw (e.g. '\n'): spare the lookup next time*/
+            glyph_cache_add(dsc->font, letter, &g, NULL);
+        }
+#endif
         return;
     }
 
     /*Don't draw anything if the character is empty. E.g. space*/
-    if((g.box_h == 0) || (g.box_w == 0)) return;
+    if((g.box_h == 0) || (g.box_w == 0)) {
+#if LV_GLYPH_CACHE_SIZE
+        /*Spare the lookup of the descriptor next time*/
+        glyph_cache_add(dsc->font, letter, &g, NULL);
+#endif
+        return;
+    }
 
     lv_point_t gpos;
     gpos.x = pos_p->x + g.ofs_x;
@@ -154,10 +204,28 @@ void lv_draw_sw_letter(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc
 #endif
     }
     else {
+#if LV_GLYPH_CACHE_SIZE
+        /*Expand the letter once, draw it from the cache from now on*/
+        entry = glyph_cache_add(dsc->font, letter, &g, map_p);
+        if(entry) {
+            draw_letter_cached(draw_ctx, dsc, pos_p, entry);
+            return;
+        }
+#endif
         draw_letter_normal(draw_ctx, dsc, &gpos, &g, map_p);
     }
 }
 
+void lv_draw_sw_glyph_cache_clear(void)
+{
+#if LV_GLYPH_CACHE_SIZE
+    if(glyph_cache) {
+        lv_lru_del(glyph_cache);
+        glyph_cache = NULL;
+    }
+#endif
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -571,3 +639,183 @@ static void draw_letter_subpx(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_
 }
 #endif /*LV_DRAW_COMPLEX && LV_USE_FONT_SUBPX*/
 
+#if LV_GLYPH_CACHE_SIZE
+/**
+ * Find a letter in the glyph cache
+ * @param font      the font of the label (the glyph may come from a fallback font)
+ * @param letter    the unicode letter
+ * @return          the descriptor and the mask of the letter or NULL if not cached
+ */
+static const glyph_entry_t * glyph_cache_get(const lv_font_t * font, uint32_t letter)
+{
+    glyph_key_t key;
+    void * entry = NULL;
+
+    if(glyph_cache) {
+        lv_memset_00(&key, sizeof(key)); /*No garbage in the padding: the key is compared by bytes*/
+        key.font = font;
+        key.letter = letter;
+        lv_lru_get(glyph_cache, &key, sizeof(key), &entry);
+    }
+
+    LV_CACHE_STATS(GLYPH, entry != NULL);
+    return entry;
+}
+
+/**
+ * Expand a letter into the glyph cache. The least recently drawn letters are dropped to make room.
+ * @param font      the font of the label
+ * @param letter    the unicode letter
+ * @param g         the descriptor of the letter
+ * @param map_p     the bitmap of the letter, NULL if nothing is drawn
+ * @return          the cached descriptor and mask or NULL if the letter can't be cached
+ */
+static const glyph_entry_t * glyph_cache_add(const lv_font_t * font, uint32_t letter, const lv_font_glyph_dsc_t * g,
+                                             const uint8_t * map_p)
+{
+    const uint8_t * bpp_opa_table_p = NULL;
+    uint32_t bpp = g->bpp;
+    if(bpp == 3) bpp = 4;   /*As draw_letter_normal() reads them*/
+
+    if(map_p) {
+        switch(bpp) {
+            case 1:
+                bpp_opa_table_p = _lv_bpp1_opa_table;
+                break;
+            case 2:
+                bpp_opa_table_p = _lv_bpp2_opa_table;
+                break;
+            case 4:
+                bpp_opa_table_p = _lv_bpp4_opa_table;
+                break;
+            case 8:
+                bpp_opa_table_p = _lv_bpp8_opa_table;
+                break;
+            default:
+                return NULL;    /*Image fonts*/
+        }
+        if(g->resolved_font->subpx) return NULL;
+    }
+
+    uint32_t mask_size = map_p ? (uint32_t)g->box_w * g->box_h : 0;
+    uint32_t entry_size = sizeof(glyph_entry_t) + mask_size;
+    if(entry_size > LV_GLYPH_CACHE_SIZE) return NULL;
+
+    if(glyph_cache == NULL) {
+        glyph_cache = lv_lru_create(LV_GLYPH_CACHE_SIZE, GLYPH_CACHE_AVG_SIZE, NULL, NULL);
+        if(glyph_cache == NULL) return NULL;
+    }
+
+    glyph_entry_t * entry = lv_mem_alloc(entry_size);
+    if(entry == NULL) return NULL;
+    entry->g = *g;
+
+    /*The pixels are stored without padding at the end of the rows*/
+    lv_opa_t * mask = (lv_opa_t *)(entry + 1);
+    uint32_t px_mask = (1U << bpp) - 1;
+    uint32_t i;
+    for(i = 0; i < mask_size; i++) {
+        uint32_t bit = i * bpp;
+        mask[i] = bpp_opa_table_p[(map_p[bit >> 3] >> (8 - bpp - (bit & 0x7))) & px_mask];
+    }
+
+    glyph_key_t key;
+    lv_memset_00(&key, sizeof(key));
+    key.font = font;
+    key.letter = letter;
+    if(lv_lru_set(glyph_cache, &key, sizeof(key), entry, entry_size) != LV_LRU_OK) {
+        lv_mem_free(entry);
+        return NULL;
+    }
+
+    return entry;
+}
+
+/**
+ * Draw a letter from the glyph cache. The same pixels as draw_letter_normal() gives.
+ * @param draw_ctx  the draw context
+ * @param dsc       the descriptor of the label
+ * @param pos_p     the position of the letter
+ * @param entry     the letter from glyph_cache_get() or glyph_cache_add()
+ */
+static void LV_ATTRIBUTE_FAST_MEM draw_letter_cached(lv_draw_ctx_t * draw_ctx, const lv_draw_label_dsc_t * dsc,
+                                                     const lv_point_t * pos_p, const glyph_entry_t * entry)
+{
+    const lv_font_glyph_dsc_t * g = &entry->g;
+    const lv_opa_t * glyph_mask = (const lv_opa_t *)(entry + 1);
+    lv_opa_t opa = dsc->opa;
+
+    /*Don't draw anything if the character is empty. E.g. space*/
+    if((g->box_h == 0) || (g->box_w == 0)) return;
+
+    lv_area_t letter_area;
+    letter_area.x1 = pos_p->x + g->ofs_x;
+    letter_area.y1 = pos_p->y + (dsc->font->line_height - dsc->font->base_line) - g->box_h - g->ofs_y;
+    letter_area.x2 = letter_area.x1 + g->box_w - 1;
+    letter_area.y2 = letter_area.y1 + g->box_h - 1;
+
+    lv_area_t fill_area;
+    if(!_lv_area_intersect(&fill_area, &letter_area, draw_ctx->clip_area)) return;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.color = dsc->color;
+    blend_dsc.opa = opa;
+    blend_dsc.blend_mode = dsc->blend_mode;
+    blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    bool mask_any = false;
+#if LV_DRAW_COMPLEX
+    mask_any = lv_draw_mask_is_any(&fill_area);
+#endif
+
+    /*Blend the whole letter right from the cache. Without anti-aliasing the mask would be rounded in place.*/
+    if(opa >= LV_OPA_MAX && !mask_any && _lv_refr_get_disp_refreshing()->driver->antialiasing) {
+        blend_dsc.blend_area = &fill_area;
+        blend_dsc.mask_buf = (lv_opa_t *)glyph_mask;
+        blend_dsc.mask_area = &letter_area;
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        return;
+    }
+
+    /*Else row by row in a copy*/
+    int32_t fill_w = lv_area_get_width(&fill_area);
+    lv_opa_t * mask_buf = lv_mem_buf_get(fill_w);
+    lv_area_t row_area;
+    row_area.x1 = fill_area.x1;
+    row_area.x2 = fill_area.x2;
+    row_area.y1 = fill_area.y1;
+    row_area.y2 = fill_area.y1;
+    blend_dsc.blend_area = &row_area;
+    blend_dsc.mask_buf = mask_buf;
+    blend_dsc.mask_area = &row_area;
+
+    glyph_mask += (fill_area.y1 - letter_area.y1) * g->box_w + (fill_area.x1 - letter_area.x1);
+    int32_t x;
+    for(; row_area.y1 <= fill_area.y2; row_area.y1++) {
+        row_area.y2 = row_area.y1;
+        if(opa >= LV_OPA_MAX) {
+            lv_memcpy(mask_buf, glyph_mask, fill_w);
+        }
+        else {
+            /*The opacity table of draw_letter_normal()*/
+            for(x = 0; x < fill_w; x++) {
+                mask_buf[x] = glyph_mask[x] == LV_OPA_COVER ? opa : ((glyph_mask[x] * opa) >> 8);
+            }
+        }
+
+        blend_dsc.mask_res = LV_DRAW_MASK_RES_CHANGED;
+#if LV_DRAW_COMPLEX
+        if(mask_any) {
+            if(lv_draw_mask_apply(mask_buf, row_area.x1, row_area.y1, fill_w) == LV_DRAW_MASK_RES_TRANSP) {
+                lv_memset_00(mask_buf, fill_w);
+            }
+        }
+#endif
+        lv_draw_sw_blend(draw_ctx, &blend_dsc);
+        glyph_mask += g->box_w;
+    }
+
+    lv_mem_buf_release(mask_buf);
+}
+#endif /*LV_GLYPH_CACHE_SIZE*/
@@ -20,10 +20,26 @@
 #define SHADOW_ENHANCE          1
 #define SPLIT_LIMIT             50
 
+/*Number of rounded corners kept by their radius and border width, 0: no cache*/
+#ifndef LV_RECT_CORNER_CACHE_SIZE
+    #define LV_RECT_CORNER_CACHE_SIZE 0
+#endif
+
+/*[px] the largest cached corner, a corner shape takes 4 * size^2 bytes*/
+#define CORNER_CACHE_MAX_SIZE   16
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+typedef struct {
+    lv_coord_t radius;      /*0: unused entry*/
+    lv_coord_t width;       /*width of the border, 0: background*/
+    lv_coord_t size;        /*the side of a corner: LV_MAX(radius, width)*/
+    uint32_t last_use;
+    lv_opa_t * opa;         /*top left, top right, bottom left and bottom right corners, size * size each*/
+} corner_entry_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -48,6 +64,12 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
 static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area, const lv_area_t * inner_area,
                                lv_color_t color, lv_opa_t opa);
 
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+static const corner_entry_t * corner_cache_get(lv_coord_t radius, lv_coord_t width);
+static void corner_calc(corner_entry_t * entry);
+static void draw_corners(lv_draw_ctx_t * draw_ctx, const corner_entry_t * entry, const lv_area_t * coords,
+                         lv_draw_sw_blend_dsc_t * blend_dsc);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -58,6 +80,12 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
     static int32_t sh_cache_r = -1;
 #endif
 
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+    static corner_entry_t corner_cache[LV_RECT_CORNER_CACHE_SIZE];
+    static uint32_t corner_cache_tick;
+    static bool corner_cache_disabled;
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -92,6 +120,25 @@ void lv_draw_sw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, con
     draw_bg_img(draw_ctx, dsc, coords);
 }
 
+void lv_draw_sw_rect_corner_cache_clear(void)
+{
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+    uint32_t i;
+    for(i = 0; i < LV_RECT_CORNER_CACHE_SIZE; i++) {
+        lv_mem_free(corner_cache[i].opa);
+    }
+    lv_memset_00(corner_cache, sizeof(corner_cache));
+#endif
+}
+
+void lv_draw_sw_rect_corner_cache_enable(bool en)
+{
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+    corner_cache_disabled = !en;
+#else
+    LV_UNUSED(en);
+#endif
+}
 
 /**********************
  *   STATIC FUNCTIONS
@@ -144,6 +191,43 @@ static void draw_bg(lv_draw_ctx_t * draw_ctx, const lv_draw_rect_dsc_t * dsc, co
     int32_t short_side = LV_MIN(coords_bg_w, coords_bg_h);
     int32_t rout = LV_MIN(dsc->radius, short_side >> 1);
 
+#if LV_RECT_CORNER_CACHE_SIZE
+    /*Opaque rounded rectangle: the corners from the cache, the rest as plain rectangles*/
+    if(!mask_any && rout > 0 && grad_dir == LV_GRAD_DIR_NONE && opa == LV_OPA_COVER) {
+        const corner_entry_t * corner = corner_cache_get(rout, 0);
+        if(corner) {
+            blend_dsc.opa = LV_OPA_COVER;
+            draw_corners(draw_ctx, corner, &bg_coords, &blend_dsc);
+
+            lv_area_t a;
+            blend_dsc.blend_area = &a;
+            blend_dsc.mask_buf = NULL;
+            blend_dsc.mask_area = NULL;
+            blend_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+
+            /*Between the top and the bottom corners*/
+            a.x1 = bg_coords.x1 + rout;
+            a.x2 = bg_coords.x2 - rout;
+            if(a.x1 <= a.x2) {
+                a.y1 = bg_coords.y1;
+                a.y2 = bg_coords.y1 + rout - 1;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+                a.y1 = bg_coords.y2 - rout + 1;
+                a.y2 = bg_coords.y2;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            }
+
+            /*The center*/
+            a.x1 = bg_coords.x1;
+            a.x2 = bg_coords.x2;
+            a.y1 = bg_coords.y1 + rout;
+            a.y2 = bg_coords.y2 - rout;
+            if(a.y1 <= a.y2) lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            return;
+        }
+    }
+#endif
+
     /*Add a radius mask if there is radius*/
     int32_t clipped_w = lv_area_get_width(&clipped_coords);
     int16_t mask_rout_id = LV_MASK_ID_INV;
@@ -488,11 +572,13 @@ static void LV_ATTRIBUTE_FAST_MEM draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
 #if LV_SHADOW_CACHE_SIZE
     if(sh_cache_size == corner_size && sh_cache_r == r_sh) {
         /*Use the cache if available*/
+        LV_CACHE_STATS(SHADOW, true);
         sh_buf = lv_mem_buf_get(corner_size * corner_size);
         lv_memcpy(sh_buf, sh_cache, corner_size * corner_size);
     }
     else {
         /*A larger buffer is required for calculation*/
+        LV_CACHE_STATS(SHADOW, false);
         sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
         shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
 
@@ -504,6 +590,7 @@ static void LV_ATTRIBUTE_FAST_MEM draw_shadow(lv_draw_ctx_t * draw_ctx, const lv
         }
     }
 #else
+    LV_CACHE_STATS(SHADOW, false);
     sh_buf = lv_mem_buf_get(corner_size * corner_size * sizeof(uint16_t));
     shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->shadow_width, r_sh);
 #endif
@@ -1166,6 +1253,60 @@ void draw_border_generic(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer_area,
         return;
     }
 
+#if LV_RECT_CORNER_CACHE_SIZE
+    /*Rounded border with the same width on every side: the corners from the cache, the sides as plain rectangles*/
+    lv_coord_t width = inner_area->x1 - outer_area->x1;
+    if(!mask_any && rout > 0 && width > 0 && rin == LV_MAX(rout - width, 0) &&
+       outer_area->x2 - inner_area->x2 == width && inner_area->y1 - outer_area->y1 == width &&
+       outer_area->y2 - inner_area->y2 == width &&
+       lv_area_get_width(inner_area) > 0 && lv_area_get_height(inner_area) > 0) {
+        const corner_entry_t * corner = corner_cache_get(rout, width);
+        lv_coord_t core_w = lv_area_get_width(outer_area) - 2 * (corner ? corner->size : 0);
+        lv_coord_t core_h = lv_area_get_height(outer_area) - 2 * (corner ? corner->size : 0);
+        /*With opacity the sides are blended with a mask where the corners are close (see `split_hor` below)*/
+        if(corner && core_w >= 0 && core_h >= 0 && (opa == LV_OPA_COVER || core_w >= SPLIT_LIMIT)) {
+            lv_draw_sw_blend_dsc_t blend_dsc;
+            lv_memset_00(&blend_dsc, sizeof(blend_dsc));
+            blend_dsc.color = color;
+            blend_dsc.opa = opa;
+            blend_dsc.blend_mode = blend_mode;
+            draw_corners(draw_ctx, corner, outer_area, &blend_dsc);
+
+            lv_area_t a;
+            blend_dsc.blend_area = &a;
+            blend_dsc.mask_buf = NULL;
+            blend_dsc.mask_area = NULL;
+            blend_dsc.mask_res = LV_DRAW_MASK_RES_FULL_COVER;
+            lv_coord_t size = corner->size;
+
+            /*Top and bottom*/
+            a.x1 = outer_area->x1 + size;
+            a.x2 = outer_area->x2 - size;
+            if(a.x1 <= a.x2) {
+                a.y1 = outer_area->y1;
+                a.y2 = inner_area->y1 - 1;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+                a.y1 = inner_area->y2 + 1;
+                a.y2 = outer_area->y2;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            }
+
+            /*Left and right*/
+            a.y1 = outer_area->y1 + size;
+            a.y2 = outer_area->y2 - size;
+            if(a.y1 <= a.y2) {
+                a.x1 = outer_area->x1;
+                a.x2 = inner_area->x1 - 1;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+                a.x1 = inner_area->x2 + 1;
+                a.x2 = outer_area->x2;
+                lv_draw_sw_blend(draw_ctx, &blend_dsc);
+            }
+            return;
+        }
+    }
+#endif
+
     /*Get clipped draw area which is the real draw area.
      *It is always the same or inside `coords`*/
     lv_area_t draw_area;
@@ -1434,3 +1575,119 @@ static void draw_border_simple(lv_draw_ctx_t * draw_ctx, const lv_area_t * outer
     }
 }
 
+#if LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE
+/**
+ * Get the four corners of a rounded rectangle or border from the cache, calculate them on a miss
+ * @param radius    the outer radius
+ * @param width     width of the border, 0: background
+ * @return          the cached corners or NULL if they can't be used (bypassed, too large, no memory,
+ *                  no anti-aliasing)
+ */
+static const corner_entry_t * corner_cache_get(lv_coord_t radius, lv_coord_t width)
+{
+    if(corner_cache_disabled) return NULL;
+
+    lv_coord_t size = LV_MAX(radius, width);
+    if(size > CORNER_CACHE_MAX_SIZE) return NULL;
+
+    /*Without anti-aliasing the blending rounds the mask in place*/
+    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+    if(disp == NULL || disp->driver->antialiasing == 0) return NULL;
+
+    corner_cache_tick++;
+
+    uint32_t i;
+    corner_entry_t * entry = &corner_cache[0];
+    for(i = 0; i < LV_RECT_CORNER_CACHE_SIZE; i++) {
+        if(corner_cache[i].radius == radius && corner_cache[i].width == width) {
+            LV_CACHE_STATS(CORNER, true);
+            corner_cache[i].last_use = corner_cache_tick;
+            return &corner_cache[i];
+        }
+        if(corner_cache[i].last_use < entry->last_use) entry = &corner_cache[i];
+    }
+
+    LV_CACHE_STATS(CORNER, false);
+
+    /*Replace the least recently used entry*/
+    if(entry->opa == NULL || entry->size != size) {
+        lv_mem_free(entry->opa);
+        entry->radius = 0;
+        entry->opa = lv_mem_alloc(4 * size * size);
+        if(entry->opa == NULL) return NULL;
+    }
+
+    entry->radius = radius;
+    entry->width = width;
+    entry->size = size;
+    entry->last_use = corner_cache_tick;
+    corner_calc(entry);
+
+    return entry;
+}
+
+/**
+ * Calculate the corners with the masks used by draw_bg() and draw_border_generic() on a rectangle
+ * larger than the two corners
+ * @param entry     the entry to fill, `radius`, `width` and `size` are set
+ */
+static void corner_calc(corner_entry_t * entry)
+{
+    lv_coord_t size = entry->size;
+    lv_area_t outer = {0, 0, 2 * size + 1, 2 * size + 1};
+    lv_area_t inner = {entry->width, entry->width, outer.x2 - entry->width, outer.y2 - entry->width};
+
+    lv_draw_mask_radius_param_t mask_rout_param;
+    lv_draw_mask_radius_param_t mask_rin_param;
+    lv_draw_mask_radius_init(&mask_rout_param, &outer, entry->radius, false);
+    if(entry->width) lv_draw_mask_radius_init(&mask_rin_param, &inner, LV_MAX(entry->radius - entry->width, 0), true);
+
+    lv_opa_t * opa = entry->opa;
+    uint32_t c;
+    for(c = 0; c < 4; c++) {
+        lv_coord_t x = c & 1 ? outer.x2 - size + 1 : 0;
+        lv_coord_t y_ofs = c & 2 ? outer.y2 - size + 1 : 0;
+        lv_coord_t y;
+        for(y = y_ofs; y < y_ofs + size; y++) {
+            lv_memset_ff(opa, size);
+            lv_draw_mask_res_t res = mask_rout_param.dsc.cb(opa, x, y, size, &mask_rout_param);
+            if(res != LV_DRAW_MASK_RES_TRANSP && entry->width) {
+                res = mask_rin_param.dsc.cb(opa, x, y, size, &mask_rin_param);
+            }
+            if(res == LV_DRAW_MASK_RES_TRANSP) lv_memset_00(opa, size);
+            opa += size;
+        }
+    }
+
+    lv_draw_mask_free_param(&mask_rout_param);
+    if(entry->width) lv_draw_mask_free_param(&mask_rin_param);
+}
+
+/**
+ * Blend the four cached corners of a rectangle
+ * @param draw_ctx  pointer to a draw context
+ * @param entry     the cached corners
+ * @param coords    the outer area of the rectangle
+ * @param blend_dsc color, opacity and blend mode, the areas and the mask are set here:
+ *                  the areas are local, reset them and the mask before blending with it again
+ */
+static void draw_corners(lv_draw_ctx_t * draw_ctx, const corner_entry_t * entry, const lv_area_t * coords,
+                         lv_draw_sw_blend_dsc_t * blend_dsc)
+{
+    lv_coord_t size = entry->size;
+    lv_area_t a;
+    blend_dsc->blend_area = &a;
+    blend_dsc->mask_area = &a;
+    blend_dsc->mask_res = LV_DRAW_MASK_RES_CHANGED;
+
+    uint32_t c;
+    for(c = 0; c < 4; c++) {
+        a.x1 = c & 1 ? coords->x2 - size + 1 : coords->x1;
+        a.y1 = c & 2 ? coords->y2 - size + 1 : coords->y1;
+        a.x2 = a.x1 + size - 1;
+        a.y2 = a.y1 + size - 1;
+        blend_dsc->mask_buf = entry->opa + c * size * size;
+        lv_draw_sw_blend(draw_ctx, blend_dsc);
+    }
+}
+#endif /*LV_DRAW_COMPLEX && LV_RECT_CORNER_CACHE_SIZE*/
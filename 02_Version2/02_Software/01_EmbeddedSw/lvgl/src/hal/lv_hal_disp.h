@@ -136,6 +136,11 @@ typedef struct _lv_disp_drv_t {
     /** OPTIONAL: called when start rendering */
     void (*render_start_cb)(struct _lv_disp_drv_t * disp_drv);
 
+    /** OPTIONAL: Estimate the time of refreshing an area (rendering and flushing in any unit).
+     * If set, invalid areas are joined whenever refreshing them together is cheaper,
+     * also areas without common parts. Else only overlapping areas are joined if the result is smaller.*/
+    uint32_t (*area_cost_cb)(struct _lv_disp_drv_t * disp_drv, const lv_area_t * area);
+
     /** On CHROMA_KEYED images this color will be transparent.
      * `LV_COLOR_CHROMA_KEY` by default. (lv_conf.h)*/
     lv_color_t color_chroma_key;
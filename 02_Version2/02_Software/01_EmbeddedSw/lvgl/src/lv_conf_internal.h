@@ -2482,6 +2482,15 @@ LV_EXPORT_CONST_INT(LV_DPI_DEF);
 #endif  /*LV_USE_LOG*/
 
 
+/*Counting the lookups of the caches (e.g. image, gradient, glyph). Nothing by default*/
+#ifdef LV_CACHE_STATS_INCLUDE
+    #include LV_CACHE_STATS_INCLUDE
+#endif
+#ifndef LV_CACHE_STATS
+    #define LV_CACHE_STATS(cache, hit)
+#endif
+
+
 /*If running without lv_conf.h add typedefs with default value*/
 #ifdef LV_CONF_SKIP
     #if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)    /*Disable warnings for Visual Studio*/
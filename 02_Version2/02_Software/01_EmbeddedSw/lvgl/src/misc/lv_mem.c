@@ -265,6 +265,8 @@ void lv_mem_monitor(lv_mem_monitor_t * mon_p)
     mon_p->max_used = max_used;
 
     MEM_TRACE("finished");
+#elif defined(LV_MEM_CUSTOM_MONITOR)
+    LV_MEM_CUSTOM_MONITOR(mon_p);
 #endif
 }
 
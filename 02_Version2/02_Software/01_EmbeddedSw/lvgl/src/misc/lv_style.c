@@ -132,6 +132,8 @@ const uint8_t _lv_style_builtin_prop_flag_lookup_table[_LV_STYLE_NUM_BUILT_IN_PR
 
 uint32_t _lv_style_custom_prop_flag_lookup_table_size = 0;
 
+uint32_t _lv_style_prop_gen = 1;
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -481,5 +483,6 @@ static void lv_style_set_prop_internal(lv_style_t * style, lv_style_prop_t prop_
 
     uint8_t group = _lv_style_get_prop_group(prop_id);
     style->has_group |= 1 << group;
+    _lv_style_prop_gen_next();
 }
 
@@ -30,6 +30,11 @@ extern "C" {
 
 #define LV_STYLE_SENTINEL_VALUE     0xAABBCCDD
 
+/*1: the objects collect the properties set in their styles and skip the styles for the others*/
+#ifndef LV_OBJ_STYLE_CACHE
+#define LV_OBJ_STYLE_CACHE 0
+#endif
+
 /**
  * Flags for style behavior
  *
@@ -502,6 +507,21 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
  */
 bool lv_style_is_empty(const lv_style_t * style);
 
+/**
+ * Changes when a property is added to a style or a style is added to an object.
+ * The properties collected from the styles of an object are valid while it doesn't change.
+ */
+extern uint32_t _lv_style_prop_gen;
+
+/**
+ * Mark the properties collected from the styles of the objects as outdated
+ */
+static inline void _lv_style_prop_gen_next(void)
+{
+    _lv_style_prop_gen++;
+    if(_lv_style_prop_gen == 0) _lv_style_prop_gen = 1;   /*0: never collected*/
+}
+
 /**
  * Tell the group of a property. If the a property from a group is set in a style the (1 << group) bit of style->has_group is set.
  * It allows early skipping the style if the property is not exists in the style at all.
@@ -18,6 +18,11 @@
 #define IDLE_MEAS_PERIOD 500 /*[ms]*/
 #define DEF_PERIOD 500
 
+#if LV_TIMER_HEAP
+    #define HEAP_NONE   0xFFFF
+    #define HEAP_WAIT   0xFFFE  /*Ran and ready again in this call of lv_timer_handler(): put back after it*/
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -27,6 +32,15 @@
  **********************/
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
+#if LV_TIMER_HEAP
+    static bool heap_reserve(void);
+    static void heap_insert(lv_timer_t * timer);
+    static void heap_remove(lv_timer_t * timer);
+    static void heap_update(lv_timer_t * timer);
+    static void heap_sift_up(uint32_t idx, uint32_t now);
+    static void heap_sift_down(uint32_t idx, uint32_t now);
+    static int64_t heap_key(const lv_timer_t * timer, uint32_t now);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -35,6 +49,13 @@ static bool lv_timer_run = false;
 static uint8_t idle_last = 0;
 static bool timer_deleted;
 static bool timer_created;
+#if LV_TIMER_HEAP
+    static uint32_t heap_cnt;   /*Running timers in the heap*/
+    static uint32_t wait_cnt;   /*Timers out of the heap with HEAP_WAIT*/
+    static uint32_t heap_size;  /*Space for all timers (running or paused) in the heap*/
+    static uint32_t timer_cnt;
+    static uint16_t handler_cnt;
+#endif
 
 /**********************
  *      MACROS
@@ -55,6 +76,13 @@ static bool timer_created;
 void _lv_timer_core_init(void)
 {
     _lv_ll_init(&LV_GC_ROOT(_lv_timer_ll), sizeof(lv_timer_t));
+#if LV_TIMER_HEAP
+    LV_GC_ROOT(_lv_timer_heap) = NULL;
+    heap_cnt = 0;
+    wait_cnt = 0;
+    heap_size = 0;
+    timer_cnt = 0;
+#endif
 
     /*Initially enable the lv_timer handling*/
     lv_timer_enable(true);
@@ -95,6 +123,46 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
         }
     }
 
+#if LV_TIMER_HEAP
+    /*Run the ready timers from the top of the heap, each at most once*/
+    handler_cnt++;
+    while(heap_cnt) {
+        lv_timer_t * timer = LV_GC_ROOT(_lv_timer_heap)[0];
+        if(heap_key(timer, lv_tick_get()) > 0) break;
+        if(timer->run_cnt == handler_cnt) {
+            /*Ready again (e.g. 0 period): let the others run, it runs in the next call*/
+            heap_remove(timer);
+            timer->heap_idx = HEAP_WAIT;
+            wait_cnt++;
+            continue;
+        }
+
+        timer->run_cnt = handler_cnt;
+        timer_deleted = false;
+        LV_GC_ROOT(_lv_timer_act) = timer;
+        lv_timer_exec(timer);
+    }
+    LV_GC_ROOT(_lv_timer_act) = NULL;
+
+    /*Rare, so simply look for them in the list*/
+    if(wait_cnt) {
+        lv_timer_t * timer = _lv_ll_get_head(&LV_GC_ROOT(_lv_timer_ll));
+        while(timer && wait_cnt) {
+            if(timer->heap_idx == HEAP_WAIT) {
+                timer->heap_idx = HEAP_NONE;
+                wait_cnt--;
+                heap_insert(timer);
+            }
+            timer = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), timer);
+        }
+    }
+
+    uint32_t time_till_next = LV_NO_TIMER_READY;
+    if(heap_cnt) {
+        int64_t key = heap_key(LV_GC_ROOT(_lv_timer_heap)[0], lv_tick_get());
+        time_till_next = key > 0 ? (uint32_t)key : 0;
+    }
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     do {
@@ -129,6 +197,7 @@ uint32_t LV_ATTRIBUTE_TIMER_HANDLER lv_timer_handler(void)
 
         next = _lv_ll_get_next(&LV_GC_ROOT(_lv_timer_ll), next); /*Find the next timer*/
     }
+#endif
 
     busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(idle_period_start);
@@ -168,6 +237,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+#if LV_TIMER_HEAP
+    /*Reserve the place in the heap now: resuming can't fail*/
+    if(!heap_reserve()) return NULL;
+#endif
+
     new_timer = _lv_ll_ins_head(&LV_GC_ROOT(_lv_timer_ll));
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -179,6 +253,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
 
+#if LV_TIMER_HEAP
+    timer_cnt++;
+    new_timer->run_cnt = handler_cnt - 1;
+    new_timer->heap_idx = HEAP_NONE;
+    heap_insert(new_timer);
+#endif
+
     timer_created = true;
 
     return new_timer;
@@ -200,6 +281,10 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
  */
 void lv_timer_del(lv_timer_t * timer)
 {
+#if LV_TIMER_HEAP
+    heap_remove(timer);
+    timer_cnt--;
+#endif
     _lv_ll_remove(&LV_GC_ROOT(_lv_timer_ll), timer);
     timer_deleted = true;
 
@@ -213,11 +298,17 @@ void lv_timer_del(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     timer->paused = true;
+#if LV_TIMER_HEAP
+    heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     timer->paused = false;
+#if LV_TIMER_HEAP
+    heap_insert(timer);
+#endif
 }
 
 /**
@@ -228,6 +319,9 @@ void lv_timer_resume(lv_timer_t * timer)
 void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     timer->period = period;
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -237,6 +331,9 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 void lv_timer_ready(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -247,6 +344,9 @@ void lv_timer_ready(lv_timer_t * timer)
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     timer->repeat_count = repeat_count;
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -257,6 +357,9 @@ void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 void lv_timer_reset(lv_timer_t * timer)
 {
     timer->last_run = lv_tick_get();
+#if LV_TIMER_HEAP
+    heap_update(timer);
+#endif
 }
 
 /**
@@ -309,6 +412,10 @@ static bool lv_timer_exec(lv_timer_t * timer)
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
+#if LV_TIMER_HEAP
+        /*The callback can change or delete the timer: find its new place before*/
+        heap_update(timer);
+#endif
         TIMER_TRACE("calling timer callback: %p", *((void **)&timer->timer_cb));
         if(timer->timer_cb && original_repeat_count != 0) timer->timer_cb(timer);
         TIMER_TRACE("timer callback %p finished", *((void **)&timer->timer_cb));
@@ -339,3 +446,130 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
         return 0;
     return timer->period - elp;
 }
+
+#if LV_TIMER_HEAP
+/**
+ * Make sure the heap has space for one more timer
+ * @return true: OK; false: out of memory
+ */
+static bool heap_reserve(void)
+{
+    if(timer_cnt >= HEAP_WAIT) return false;
+    if(timer_cnt < heap_size) return true;
+
+    uint32_t new_size = heap_size ? heap_size * 2 : 8;
+    lv_timer_t ** new_heap = lv_mem_realloc(LV_GC_ROOT(_lv_timer_heap), new_size * sizeof(lv_timer_t *));
+    LV_ASSERT_MALLOC(new_heap);
+    if(new_heap == NULL) return false;
+
+    LV_GC_ROOT(_lv_timer_heap) = new_heap;
+    heap_size = new_size;
+    return true;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    /*Resumed but not paused, or waiting to be put back*/
+    if(timer->heap_idx != HEAP_NONE) return;
+
+    LV_GC_ROOT(_lv_timer_heap)[heap_cnt] = timer;
+    timer->heap_idx = (uint16_t)heap_cnt;
+    heap_cnt++;
+    heap_sift_up(timer->heap_idx, lv_tick_get());
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == HEAP_NONE) return;
+    if(idx == HEAP_WAIT) {
+        timer->heap_idx = HEAP_NONE;
+        wait_cnt--;
+        return;
+    }
+
+    timer->heap_idx = HEAP_NONE;
+    heap_cnt--;
+    if(idx == heap_cnt) return;
+
+    /*Move the last timer to the hole*/
+    lv_timer_t * last = LV_GC_ROOT(_lv_timer_heap)[heap_cnt];
+    LV_GC_ROOT(_lv_timer_heap)[idx] = last;
+    last->heap_idx = (uint16_t)idx;
+    heap_update(last);
+}
+
+/**
+ * Move a timer to its place after its next run has changed
+ */
+static void heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_idx == HEAP_NONE || timer->heap_idx == HEAP_WAIT) return;
+
+    uint32_t now = lv_tick_get();
+    heap_sift_up(timer->heap_idx, now);
+    heap_sift_down(timer->heap_idx, now);
+}
+
+static void heap_sift_up(uint32_t idx, uint32_t now)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    int64_t key = heap_key(timer, now);
+
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(heap_key(heap[parent], now) <= key) break;
+        heap[idx] = heap[parent];
+        heap[idx]->heap_idx = (uint16_t)idx;
+        idx = parent;
+    }
+
+    heap[idx] = timer;
+    timer->heap_idx = (uint16_t)idx;
+}
+
+static void heap_sift_down(uint32_t idx, uint32_t now)
+{
+    lv_timer_t ** heap = LV_GC_ROOT(_lv_timer_heap);
+    lv_timer_t * timer = heap[idx];
+    int64_t key = heap_key(timer, now);
+
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= heap_cnt) break;
+
+        int64_t child_key = heap_key(heap[child], now);
+        if(child + 1 < heap_cnt) {
+            int64_t right_key = heap_key(heap[child + 1], now);
+            if(right_key < child_key) {
+                child++;
+                child_key = right_key;
+            }
+        }
+        if(key <= child_key) break;
+
+        heap[idx] = heap[child];
+        heap[idx]->heap_idx = (uint16_t)idx;
+        idx = child;
+    }
+
+    heap[idx] = timer;
+    timer->heap_idx = (uint16_t)idx;
+}
+
+/**
+ * The key of a timer in the heap: the time till its next run, negative if it's late.
+ * The keys of all timers decrease together, so the order in the heap remains valid as the time passes.
+ * @param timer     pointer to a timer
+ * @param now       the current tick
+ * @return          [ms] the time till the next run
+ */
+static int64_t heap_key(const lv_timer_t * timer, uint32_t now)
+{
+    /*Deleted in the next call of lv_timer_handler()*/
+    if(timer->repeat_count == 0) return INT64_MIN;
+
+    return (int64_t)timer->period - (uint32_t)(now - timer->last_run);
+}
+#endif /*LV_TIMER_HEAP*/
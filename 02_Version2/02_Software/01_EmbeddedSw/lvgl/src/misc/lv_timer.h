@@ -27,6 +27,12 @@ extern "C" {
 
 #define LV_NO_TIMER_READY 0xFFFFFFFF
 
+/*1: keep the running timers in a min-heap by their next run. `lv_timer_handler()` visits only
+ *the ready timers and tells the time till the next one without scanning the list.*/
+#ifndef LV_TIMER_HEAP
+#define LV_TIMER_HEAP 0
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -48,6 +54,10 @@ typedef struct _lv_timer_t {
     void * user_data; /**< Custom user data*/
     int32_t repeat_count; /**< 1: One time;  -1 : infinity;  n>0: residual times*/
     uint32_t paused : 1;
+#if LV_TIMER_HEAP
+    uint16_t heap_idx; /**< Place in the heap, 0xFFFF if paused*/
+    uint16_t run_cnt; /**< The call of `lv_timer_handler()` in which the timer ran last*/
+#endif
 } lv_timer_t;
 
 /**********************
@@ -1,5 +1,5 @@
 #include "../lv_conf_internal.h"
-#if LV_MEM_CUSTOM == 0
+#if LV_MEM_CUSTOM == 0 || (defined(LV_MEM_CUSTOM_TLSF) && LV_MEM_CUSTOM_TLSF)
 
 #include <limits.h>
 #include "lv_tlsf.h"
@@ -1243,4 +1243,4 @@ void * lv_tlsf_realloc(lv_tlsf_t tlsf, void * ptr, size_t size)
     return p;
 }
 
-#endif /* LV_MEM_CUSTOM == 0 */
+#endif /* LV_MEM_CUSTOM == 0 || LV_MEM_CUSTOM_TLSF */
@@ -27,6 +27,9 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag, lv_txt_layout_t * layout);
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
     static uint8_t lv_txt_utf8_size(const char * str);
     static uint32_t lv_txt_unicode_to_utf8(uint32_t letter_uni);
@@ -91,49 +94,28 @@
 void lv_txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, lv_coord_t letter_space,
                      lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
 {
-    size_res->x = 0;
-    size_res->y = 0;
-
-    if(text == NULL) return;
-    if(font == NULL) return;
-
-    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
-
-    uint32_t line_start     = 0;
-    uint32_t new_line_start = 0;
-    uint16_t letter_height = lv_font_get_line_height(font);
-
-    /*Calc. the height and longest line*/
-    while(text[line_start] != '\0') {
-        new_line_start += _lv_txt_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
-
-        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
-            LV_LOG_WARN("lv_txt_get_size: integer overflow while calculating text height");
-            return;
-        }
-        else {
-            size_res->y += letter_height;
-            size_res->y += line_space;
-        }
-
-        /*Calculate the longest line*/
-        lv_coord_t act_line_length = lv_txt_get_width(&text[line_start], new_line_start - line_start, font, letter_space,
-                                                      flag);
-
-        size_res->x = LV_MAX(act_line_length, size_res->x);
-        line_start  = new_line_start;
-    }
-
-    /*Make the text one line taller if the last character is '\n' or '\r'*/
-    if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
-        size_res->y += letter_height + line_space;
-    }
+    txt_get_size(size_res, text, font, letter_space, line_space, max_width, flag, NULL);
+}
 
-    /*Correction with the last line space or set the height manually if the text is empty*/
-    if(size_res->y == 0)
-        size_res->y = letter_height;
-    else
-        size_res->y -= line_space;
+void _lv_txt_layout(lv_txt_layout_t * layout, const char * text, const lv_font_t * font, lv_coord_t letter_space,
+                    lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    /*Without wrapping the lines are the same as with a width which never wraps*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+    flag &= LV_TEXT_FLAG_RECOLOR;
+
+    bool hit = layout->valid && layout->font == font && layout->letter_space == letter_space &&
+               layout->line_space == line_space && layout->max_width == max_width && layout->flag == flag;
+    LV_CACHE_STATS(LAYOUT, hit);
+    if(hit) return;
+
+    layout->font = font;
+    layout->letter_space = letter_space;
+    layout->line_space = line_space;
+    layout->max_width = max_width;
+    layout->flag = flag;
+    layout->valid = 1;
+    txt_get_size(&layout->size, text, font, letter_space, line_space, max_width, flag, layout);
 }
 
 /**
@@ -496,6 +478,90 @@ void _lv_txt_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t
     *letter_next = *letter != '\0' ? _lv_txt_encoded_next(&txt[*ofs], NULL) : 0;
 }
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * The size of a text as `lv_txt_get_size()` gives it
+ * @param layout    store the lines here too, NULL if not required
+ */
+static void txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag, lv_txt_layout_t * layout)
+{
+    size_res->x = 0;
+    size_res->y = 0;
+    if(layout) layout->line_cnt = 0;
+
+    if(text == NULL) return;
+    if(font == NULL) return;
+
+    if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
+
+    uint32_t line_start     = 0;
+    uint32_t new_line_start = 0;
+    uint16_t letter_height = lv_font_get_line_height(font);
+
+    /*A single line which surely fits (e.g. a number) is measured once: _lv_txt_get_next_line()
+     *would sum the same letter widths word by word only to find the end of the text*/
+    if(letter_space >= 0 && text[0] != '\0') {
+        uint32_t len = 0;
+        while(text[len] != '\0' && text[len] != '\n' && text[len] != '\r') len++;
+        if(text[len] == '\0') {
+            lv_coord_t w = lv_txt_get_width(text, len, font, letter_space, flag);
+            if((int32_t)w + letter_space < max_width) {
+                size_res->x = w;
+                size_res->y = letter_height;
+                if(layout) {
+                    layout->line_cnt = 1;
+                    layout->line_end[0] = len;
+                    layout->line_w[0] = w;
+                }
+                return;
+            }
+        }
+    }
+
+    /*Calc. the height and longest line*/
+    while(text[line_start] != '\0') {
+        new_line_start += _lv_txt_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+
+        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(lv_coord_t)) {
+            LV_LOG_WARN("lv_txt_get_size: integer overflow while calculating text height");
+            return;
+        }
+        else {
+            size_res->y += letter_height;
+            size_res->y += line_space;
+        }
+
+        /*Calculate the longest line*/
+        lv_coord_t act_line_length = lv_txt_get_width(&text[line_start], new_line_start - line_start, font, letter_space,
+                                                      flag);
+        if(layout) {
+            if(layout->line_cnt < _LV_TXT_LAYOUT_LINES) {
+                layout->line_end[layout->line_cnt] = new_line_start;
+                layout->line_w[layout->line_cnt] = act_line_length;
+            }
+            layout->line_cnt++;
+        }
+
+        size_res->x = LV_MAX(act_line_length, size_res->x);
+        line_start  = new_line_start;
+    }
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
+        size_res->y += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(size_res->y == 0)
+        size_res->y = letter_height;
+    else
+        size_res->y -= line_space;
+}
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
 /*******************************
  *   UTF-8 ENCODER/DECODER
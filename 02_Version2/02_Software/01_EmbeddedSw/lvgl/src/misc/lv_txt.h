@@ -32,6 +32,12 @@ extern "C" {
 #define LV_TXT_ENC_UTF8 1
 #define LV_TXT_ENC_ASCII 2
 
+/*Number of lines stored in a text layout (`lv_txt_layout_t`), 0: the labels don't keep their layout*/
+#ifndef LV_LABEL_LAYOUT_CACHE
+#define LV_LABEL_LAYOUT_CACHE 0
+#endif
+#define _LV_TXT_LAYOUT_LINES (LV_LABEL_LAYOUT_CACHE > 0 ? LV_LABEL_LAYOUT_CACHE : 1)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -65,6 +71,23 @@ enum {
 };
 typedef uint8_t lv_text_align_t;
 
+/**
+ * A text laid out by `_lv_txt_layout()`. It is kept until the text changes
+ * (see `_lv_txt_layout_invalidate()`) and it is computed again if the parameters change.
+ */
+typedef struct {
+    const lv_font_t * font;
+    lv_coord_t letter_space;
+    lv_coord_t line_space;
+    lv_coord_t max_width;       /**< LV_COORD_MAX with LV_TEXT_FLAG_EXPAND or LV_TEXT_FLAG_FIT*/
+    lv_text_flag_t flag;        /**< Only LV_TEXT_FLAG_RECOLOR, the others are in `max_width`*/
+    uint8_t valid;
+    uint16_t line_cnt;          /**< All lines, the first `_LV_TXT_LAYOUT_LINES` are stored*/
+    lv_point_t size;            /**< As `lv_txt_get_size()` gives it*/
+    uint32_t line_end[_LV_TXT_LAYOUT_LINES];    /**< Byte index of the first character of the next line*/
+    lv_coord_t line_w[_LV_TXT_LAYOUT_LINES];    /**< As `lv_txt_get_width()` gives it*/
+} lv_txt_layout_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -83,6 +106,29 @@ typedef uint8_t lv_text_align_t;
 void lv_txt_get_size(lv_point_t * size_res, const char * text, const lv_font_t * font, lv_coord_t letter_space,
                      lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
 
+/**
+ * Lay out a text: its size and its lines as `lv_txt_get_size()` and `_lv_txt_get_next_line()` give them.
+ * Nothing is computed if the layout is valid and it was made with the same parameters.
+ * @param layout pointer to a layout, the result
+ * @param text pointer to a text
+ * @param font pointer to font of the text
+ * @param letter_space letter space of the text
+ * @param line_space line space of the text
+ * @param max_width max width of the text (break the lines to fit this size)
+ * @param flag settings for the text from ::lv_text_flag_t
+ */
+void _lv_txt_layout(lv_txt_layout_t * layout, const char * text, const lv_font_t * font, lv_coord_t letter_space,
+                    lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
+
+/**
+ * Mark a layout as outdated, e.g. because its text has changed
+ * @param layout pointer to a layout
+ */
+static inline void _lv_txt_layout_invalidate(lv_txt_layout_t * layout)
+{
+    layout->valid = 0;
+}
+
 /**
  * Get the next line of text. Check line length and break chars too.
  * @param txt a '\0' terminated string
@@ -41,6 +41,8 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag);
 static void lv_label_revert_dots(lv_obj_t * label);
 
 static bool lv_label_set_dot_tmp(lv_obj_t * label, char * data, uint32_t len);
@@ -706,6 +708,10 @@ static void lv_label_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     label->hint.y          = 0;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_invalidate(&label->layout);
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     label->sel_start = LV_DRAW_LABEL_NO_TXT_SEL;
     label->sel_end   = LV_DRAW_LABEL_NO_TXT_SEL;
@@ -776,7 +782,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
         if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) w = LV_COORD_MAX;
         else w = lv_obj_get_content_width(obj);
 
-        lv_txt_get_size(&size, label->text, font, letter_space, line_space, w, flag);
+        get_txt_size(obj, &size, font, letter_space, line_space, w, flag);
 
         lv_point_t * self_size = lv_event_get_param(e);
         self_size->x = LV_MAX(self_size->x, size.x);
@@ -819,6 +825,13 @@ static void draw_main(lv_event_t * e)
         label_draw_dsc.sel_bg_color = lv_obj_get_style_bg_color(obj, LV_PART_SELECTED);
     }
 
+#if LV_LABEL_LAYOUT_CACHE
+    /*Normally the lines were found already by lv_label_refr_text()*/
+    _lv_txt_layout(&label->layout, label->text, label_draw_dsc.font, label_draw_dsc.letter_space,
+                   label_draw_dsc.line_space, lv_area_get_width(&txt_coords), flag);
+    label_draw_dsc.layout = &label->layout;
+#endif
+
     /* In SCROLL and SCROLL_CIRCULAR mode the CENTER and RIGHT are pointless, so remove them.
      * (In addition, they will create misalignment in this situation)*/
     if((label->long_mode == LV_LABEL_LONG_SCROLL || label->long_mode == LV_LABEL_LONG_SCROLL_CIRCULAR) &&
@@ -899,6 +912,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
 #if LV_LABEL_LONG_TXT_HINT
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_invalidate(&label->layout);
+#endif
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -914,7 +930,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     if(label->expand != 0) flag |= LV_TEXT_FLAG_EXPAND;
     if(lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT && !obj->w_layout) flag |= LV_TEXT_FLAG_FIT;
 
-    lv_txt_get_size(&size, label->text, font, letter_space, line_space, max_w, flag);
+    get_txt_size(obj, &size, font, letter_space, line_space, max_w, flag);
 
     lv_obj_refresh_self_size(obj);
 
@@ -1158,6 +1174,9 @@ static void lv_label_refr_text(lv_obj_t * obj)
                 }
                 label->text[byte_id_ori + LV_LABEL_DOT_NUM] = '\0';
                 label->dot_end                              = letter_id + LV_LABEL_DOT_NUM;
+#if LV_LABEL_LAYOUT_CACHE
+                _lv_txt_layout_invalidate(&label->layout);
+#endif
             }
         }
     }
@@ -1190,6 +1209,27 @@ static void lv_label_revert_dots(lv_obj_t * obj)
     lv_label_dot_tmp_free(obj);
 
     label->dot_end = LV_LABEL_DOT_END_INV;
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout_invalidate(&label->layout);
+#endif
+}
+
+/**
+ * Get the size of the text of the label as `lv_txt_get_size()` does.
+ * With LV_LABEL_LAYOUT_CACHE it is computed only if the text or the parameters have changed.
+ * @param obj pointer to a label object
+ */
+static void get_txt_size(lv_obj_t * obj, lv_point_t * size_res, const lv_font_t * font, lv_coord_t letter_space,
+                         lv_coord_t line_space, lv_coord_t max_width, lv_text_flag_t flag)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+#if LV_LABEL_LAYOUT_CACHE
+    _lv_txt_layout(&label->layout, label->text, font, letter_space, line_space, max_width, flag);
+    *size_res = label->layout.size;
+#else
+    lv_txt_get_size(size_res, label->text, font, letter_space, line_space, max_width, flag);
+#endif
 }
 
 /**
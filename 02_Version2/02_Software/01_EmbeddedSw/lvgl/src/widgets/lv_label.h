@@ -63,6 +63,10 @@ typedef struct {
     lv_draw_label_hint_t hint;
 #endif
 
+#if LV_LABEL_LAYOUT_CACHE
+    lv_txt_layout_t layout;     /*The size and the lines of the text, valid until the text changes*/
+#endif
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;